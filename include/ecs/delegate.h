@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Non-allocating callable wrapper: the callable lives inline in two pointers
+// worth of storage and dispatch is a single function-pointer call. Callables
+// must be trivially copyable and destructible — plain lambdas with small
+// captures, function pointers and the like.
+template <typename Signature>
+class Delegate;
+
+template <typename R, typename... Args>
+class Delegate<R(Args...)>
+{
+public:
+	Delegate() = default;
+
+	template <typename Callable>
+		requires (not std::is_same_v<std::remove_cvref_t<Callable>, Delegate>)
+			&& std::is_invocable_r_v<R, Callable&, Args...>
+	Delegate(Callable callable)
+	{
+		using Stored = std::remove_cvref_t<Callable>;
+		static_assert(sizeof(Stored) <= storageSize && alignof(Stored) <= alignof(void*),
+			"callable does not fit the delegate's inline storage");
+		static_assert(std::is_trivially_copyable_v<Stored> && std::is_trivially_destructible_v<Stored>,
+			"delegates only hold trivially copyable callables");
+		new (storage) Stored{std::move(callable)};
+		invoke = [](void* stored, Args... args) -> R
+		{
+			return (*std::launder(static_cast<Stored*>(stored)))(std::forward<Args>(args)...);
+		};
+	}
+
+	// Compile-time binding: the target is baked into the trampoline as a
+	// template argument, so the call is direct and only the object pointer
+	// occupies the inline storage. Function can be a member function pointer
+	// or any free function invocable with (T*, Args...).
+	template <auto Function, typename T>
+		requires std::is_invocable_r_v<R, decltype(Function), T*, Args...>
+	static Delegate bind(T* instance)
+	{
+		Delegate delegate;
+		new (delegate.storage) T*{instance};
+		delegate.invoke = [](void* stored, Args... args) -> R
+		{
+			return std::invoke(Function,
+				*std::launder(static_cast<T**>(stored)), std::forward<Args>(args)...);
+		};
+		return delegate;
+	}
+
+	template <auto Function>
+		requires std::is_invocable_r_v<R, decltype(Function), Args...>
+	static Delegate bind()
+	{
+		Delegate delegate;
+		delegate.invoke = [](void*, Args... args) -> R
+		{
+			return std::invoke(Function, std::forward<Args>(args)...);
+		};
+		return delegate;
+	}
+
+	R operator()(Args... args)
+	{
+		return invoke(storage, std::forward<Args>(args)...);
+	}
+
+	explicit operator bool() const
+	{
+		return invoke != nullptr;
+	}
+
+private:
+	static constexpr std::size_t storageSize = 2 * sizeof(void*);
+
+	alignas(void*) std::byte storage[storageSize];
+	R (*invoke)(void*, Args...) = nullptr;
+};
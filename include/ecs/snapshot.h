@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ecs/world.h"
+
+// Binary World snapshots. Component types are registered up front with a
+// caller-chosen tag that must stay stable across builds; the on-disk format
+// mirrors the storage layout (packed entity array + packed component array),
+// so saving is a handful of bulk writes per storage and loading memory-maps
+// the file and reconstructs each storage with bulk copies — no per-entity
+// serialization calls on either path. Only trivially copyable components can
+// be snapshotted.
+class Snapshot
+{
+public:
+	template <typename Component>
+	void registerComponent(std::uint32_t tag)
+	{
+		static_assert(std::is_trivially_copyable_v<Component>,
+			"snapshots only support trivially copyable components");
+		// Empty tag components have no state: only their entity array goes
+		// to disk, recorded as a component size of zero.
+		entries.push_back({
+			tag,
+			static_cast<std::uint32_t>(std::is_empty_v<Component> ? 0 : sizeof(Component)),
+			[](World const& world, std::ofstream& out)
+			{
+				if (not world.hasStorage<Component>())
+				{
+					writeValue<std::uint64_t>(out, 0);
+					return;
+				}
+				auto& storage = world.getStorage<Component>();
+				auto count = storage.entities.size();
+				writeValue<std::uint64_t>(out, count);
+				writeBytes(out, storage.entities.data(), count * sizeof(Entity));
+				if constexpr (not std::is_empty_v<Component>)
+				{
+					writeBytes(out, storage.components.data(), count * sizeof(Component));
+				}
+			},
+			[](World& world, std::byte const* entityBytes, std::byte const* componentBytes, std::size_t count)
+			{
+				world.ensureStorage<Component>();
+				auto& storage = world.getStorage<Component>();
+				storage.entities.resize(count);
+				storage.components.resize(count);
+				if (count > 0)
+				{
+					std::memcpy(storage.entities.data(), entityBytes, count * sizeof(Entity));
+					if constexpr (not std::is_empty_v<Component>)
+					{
+						std::memcpy(storage.components.data(), componentBytes, count * sizeof(Component));
+					}
+				}
+				storage.sparsePages.clear();
+				storage.versions.assign(count, 0);
+				storage.currentVersion = 0;
+				auto bit = World::signatureBit<Component>();
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					auto id = storage.entities[i].entityId;
+					// Ids come straight from disk; reject anything outside
+					// the entity table before it indexes the signatures.
+					if (id >= world.generations.size())
+					{
+						throw std::runtime_error{"Snapshot: entity id out of range"};
+					}
+					storage.sparseSlot(id) = i;
+					world.signatures[id] |= bit;
+				}
+			},
+		});
+	}
+
+	void save(World const& world, std::string const& path) const
+	{
+		std::ofstream out{path, std::ios::binary | std::ios::trunc};
+		if (not out)
+		{
+			throw std::runtime_error{"Snapshot: cannot open " + path + " for writing"};
+		}
+		writeValue(out, magic);
+		writeValue(out, version);
+		writeValue<std::uint64_t>(out, world.generations.size());
+		writeBytes(out, world.generations.data(), world.generations.size() * sizeof(unsigned));
+		writeValue<std::uint64_t>(out, world.freeIds.size());
+		writeBytes(out, world.freeIds.data(), world.freeIds.size() * sizeof(unsigned));
+		writeValue<std::uint64_t>(out, world.aliveCount);
+		writeValue<std::uint32_t>(out, static_cast<std::uint32_t>(entries.size()));
+		for (auto& entry: entries)
+		{
+			writeValue(out, entry.tag);
+			writeValue(out, entry.componentSize);
+			entry.saveStorage(world, out);
+		}
+	}
+
+	// Maps the file read-only and rebuilds the entity table and every
+	// registered storage in the given world with bulk copies; the kernel
+	// pages the data in lazily as the copies touch it.
+	void load(World& world, std::string const& path) const
+	{
+		auto fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			throw std::runtime_error{"Snapshot: cannot open " + path + " for reading"};
+		}
+		struct stat fileInfo{};
+		if (::fstat(fd, &fileInfo) != 0)
+		{
+			::close(fd);
+			throw std::runtime_error{"Snapshot: cannot stat " + path};
+		}
+		auto size = static_cast<std::size_t>(fileInfo.st_size);
+		auto* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (mapped == MAP_FAILED)
+		{
+			throw std::runtime_error{"Snapshot: cannot map " + path};
+		}
+		try
+		{
+			loadMapped(world, static_cast<std::byte const*>(mapped), size);
+		}
+		catch (...)
+		{
+			::munmap(mapped, size);
+			throw;
+		}
+		::munmap(mapped, size);
+	}
+
+private:
+	static constexpr std::uint32_t magic = 0x45435353; // "ECSS"
+	static constexpr std::uint32_t version = 1;
+
+	struct Entry
+	{
+		std::uint32_t tag;
+		std::uint32_t componentSize;
+		void (*saveStorage)(World const&, std::ofstream&);
+		void (*loadStorage)(World&, std::byte const* entityBytes, std::byte const* componentBytes, std::size_t count);
+	};
+
+	struct Cursor
+	{
+		std::byte const* position;
+		std::byte const* end;
+
+		template <typename T>
+		T read()
+		{
+			T value;
+			take(sizeof(T));
+			std::memcpy(&value, position - sizeof(T), sizeof(T));
+			return value;
+		}
+
+		std::byte const* take(std::size_t count)
+		{
+			// Compare against the remaining bytes rather than forming
+			// position + count, which could wrap for a hostile count.
+			if (count > static_cast<std::size_t>(end - position))
+			{
+				throw std::runtime_error{"Snapshot: truncated file"};
+			}
+			auto* taken = position;
+			position += count;
+			return taken;
+		}
+
+		// take() for count elements of elementSize bytes, rejecting counts
+		// whose byte total would overflow before the bounds check sees it.
+		std::byte const* takeArray(std::uint64_t count, std::size_t elementSize)
+		{
+			if (elementSize != 0
+				&& count > static_cast<std::size_t>(end - position) / elementSize)
+			{
+				throw std::runtime_error{"Snapshot: truncated file"};
+			}
+			return take(count * elementSize);
+		}
+	};
+
+	template <typename T>
+	static void writeValue(std::ofstream& out, T value)
+	{
+		writeBytes(out, &value, sizeof(T));
+	}
+
+	static void writeBytes(std::ofstream& out, void const* data, std::size_t count)
+	{
+		out.write(static_cast<char const*>(data), static_cast<std::streamsize>(count));
+	}
+
+	void loadMapped(World& world, std::byte const* data, std::size_t size) const
+	{
+		auto cursor = Cursor{data, data + size};
+		if (cursor.read<std::uint32_t>() != magic || cursor.read<std::uint32_t>() != version)
+		{
+			throw std::runtime_error{"Snapshot: bad header"};
+		}
+		auto generationCount = cursor.read<std::uint64_t>();
+		auto* generationBytes = cursor.takeArray(generationCount, sizeof(unsigned));
+		auto freeCount = cursor.read<std::uint64_t>();
+		auto* freeBytes = cursor.takeArray(freeCount, sizeof(unsigned));
+		auto aliveCount = cursor.read<std::uint64_t>();
+
+		world.generations.resize(generationCount);
+		world.signatures.assign(generationCount, 0);
+		world.freeIds.resize(freeCount);
+		if (generationCount > 0)
+		{
+			std::memcpy(world.generations.data(), generationBytes, generationCount * sizeof(unsigned));
+		}
+		if (freeCount > 0)
+		{
+			std::memcpy(world.freeIds.data(), freeBytes, freeCount * sizeof(unsigned));
+		}
+		// Free-list ids index the entity table on the next createEntity, so
+		// they get the same validation as the storages' entity ids below.
+		for (auto id: world.freeIds)
+		{
+			if (id >= generationCount)
+			{
+				throw std::runtime_error{"Snapshot: entity id out of range"};
+			}
+		}
+		world.aliveCount = aliveCount;
+
+		auto storedEntries = cursor.read<std::uint32_t>();
+		for (std::uint32_t i = 0; i < storedEntries; ++i)
+		{
+			auto tag = cursor.read<std::uint32_t>();
+			auto componentSize = cursor.read<std::uint32_t>();
+			auto count = cursor.read<std::uint64_t>();
+			auto* entityBytes = cursor.takeArray(count, sizeof(Entity));
+			auto* componentBytes = cursor.takeArray(count, componentSize);
+			auto found = std::find_if(entries.begin(), entries.end(),
+				[tag](Entry const& entry) { return entry.tag == tag; });
+			if (found == entries.end())
+			{
+				throw std::runtime_error{"Snapshot: unregistered component tag"};
+			}
+			if (found->componentSize != componentSize)
+			{
+				throw std::runtime_error{"Snapshot: component size mismatch"};
+			}
+			found->loadStorage(world, entityBytes, componentBytes, count);
+		}
+	}
+
+	std::vector<Entry> entries;
+};
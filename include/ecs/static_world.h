@@ -0,0 +1,275 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "ecs/world.h"
+
+// A World for closed component sets known at compile time. Each storage is a
+// direct tuple member, getStorage resolves to a member access at compile
+// time, and destroyEntity is a fold over the pack — no StorageBase virtual
+// calls, no shared_ptr indirection, no typeid anywhere. The trade-off is the
+// dynamism World keeps: no events, groups or copy-on-write clones, and a
+// component type outside the pack is a compile error. The assign/get/view
+// surface matches World.
+template <typename... Components>
+class StaticWorld
+{
+	template <typename Component>
+	static constexpr bool isKnown = (std::is_same_v<Component, Components> || ...);
+
+public:
+	// Mutation through a dead handle is ignored, same as World: writing
+	// through one would corrupt whatever entity has recycled the slot.
+	template <typename Component, typename... Ts>
+	void assign(Entity entity, Ts&&... args)
+	{
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		storage<Component>().insert_or_assign(entity, Component{args...});
+	}
+
+	template <typename Component>
+	Component const& get(Entity entity) const
+	{
+		return storage<Component>().at(entity);
+	}
+
+	template <typename Component>
+	Component const* try_get(Entity entity) const
+	{
+		if (not isAlive(entity))
+		{
+			return nullptr;
+		}
+		return storage<Component>().find(entity);
+	}
+
+	template <typename Component>
+	bool has(Entity entity) const
+	{
+		return isAlive(entity) && storage<Component>().contains(entity);
+	}
+
+	template <typename Component>
+	void remove(Entity entity)
+	{
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		storage<Component>().erase(entity);
+	}
+
+	std::size_t size() const
+	{
+		return aliveCount;
+	}
+
+	Entity createEntity()
+	{
+		if (not freeIds.empty())
+		{
+			auto id = freeIds.back();
+			freeIds.pop_back();
+			++aliveCount;
+			return Entity{id, generations[id]};
+		}
+		auto id = static_cast<unsigned>(generations.size());
+		generations.push_back(0);
+		++aliveCount;
+		return Entity{id};
+	}
+
+	void destroyEntity(Entity entity)
+	{
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		(storage<Components>().erase(entity), ...);
+		++generations[entity.entityId];
+		freeIds.push_back(entity.entityId);
+		--aliveCount;
+	}
+
+	bool isAlive(Entity entity) const
+	{
+		return entity.entityId < generations.size()
+			&& generations[entity.entityId] == entity.generation;
+	}
+
+	template <typename Component>
+	void reserve(std::size_t capacity)
+	{
+		storage<Component>().reserve(capacity);
+	}
+
+	template <typename... Viewed>
+	auto view() const
+	{
+		return View<Viewed...>{&storage<Viewed>()...};
+	}
+
+private:
+	template <typename Component>
+	struct Storage
+	{
+		// Same layout as World's storage — packed dense arrays plus a paged
+		// sparse index — minus the event dispatchers and change tracking.
+		static constexpr std::size_t sparsePageSize = 4096;
+		static constexpr std::size_t missing = std::numeric_limits<std::size_t>::max();
+
+		std::vector<Component> components;
+		std::vector<Entity> entities;
+		std::vector<std::unique_ptr<std::array<std::size_t, sparsePageSize>>> sparsePages;
+
+		std::size_t sparseGet(unsigned id) const
+		{
+			auto page = id / sparsePageSize;
+			if (page >= sparsePages.size() || not sparsePages[page])
+			{
+				return missing;
+			}
+			return (*sparsePages[page])[id % sparsePageSize];
+		}
+
+		std::size_t& sparseSlot(unsigned id)
+		{
+			auto page = id / sparsePageSize;
+			if (page >= sparsePages.size())
+			{
+				sparsePages.resize(page + 1);
+			}
+			if (not sparsePages[page])
+			{
+				sparsePages[page] = std::make_unique<std::array<std::size_t, sparsePageSize>>();
+				sparsePages[page]->fill(missing);
+			}
+			return (*sparsePages[page])[id % sparsePageSize];
+		}
+
+		bool contains(Entity entity) const
+		{
+			return sparseGet(entity.entityId) != missing;
+		}
+
+		// at() requires a present entity, asserted like World's storage.
+		Component& at(Entity entity)
+		{
+			auto index = sparseGet(entity.entityId);
+			assert(index != missing);
+			return components[index];
+		}
+
+		Component const& at(Entity entity) const
+		{
+			auto index = sparseGet(entity.entityId);
+			assert(index != missing);
+			return components[index];
+		}
+
+		Component const* find(Entity entity) const
+		{
+			auto index = sparseGet(entity.entityId);
+			return index == missing ? nullptr : &components[index];
+		}
+
+		void insert_or_assign(Entity entity, Component component)
+		{
+			auto& slot = sparseSlot(entity.entityId);
+			if (slot != missing)
+			{
+				components[slot] = std::move(component);
+				return;
+			}
+			slot = components.size();
+			components.push_back(std::move(component));
+			entities.push_back(entity);
+		}
+
+		void erase(Entity entity)
+		{
+			auto index = sparseGet(entity.entityId);
+			if (index == missing)
+			{
+				return;
+			}
+			auto lastIndex = components.size() - 1;
+			if (index != lastIndex)
+			{
+				components[index] = std::move(components[lastIndex]);
+				entities[index] = entities[lastIndex];
+				sparseSlot(entities[index].entityId) = index;
+			}
+			components.pop_back();
+			entities.pop_back();
+			sparseSlot(entity.entityId) = missing;
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			components.reserve(capacity);
+			entities.reserve(capacity);
+			for (std::size_t id = 0; id < capacity; id += sparsePageSize)
+			{
+				sparseSlot(static_cast<unsigned>(id));
+			}
+		}
+	};
+
+	template <typename... Viewed>
+	class View
+	{
+	public:
+		explicit View(Storage<Viewed> const*... storages_)
+			: storages{storages_...}
+		{}
+
+		template <typename Callable>
+		void each(Callable f) const
+		{
+			// Reverse iteration over the base storage, same as World's views,
+			// so the callback may remove the current entity's components.
+			auto& baseEntities = std::get<0>(storages)->entities;
+			for (auto index = baseEntities.size(); index-- > 0;)
+			{
+				auto entity = baseEntities[index];
+				if ((std::get<Storage<Viewed> const*>(storages)->contains(entity) && ...))
+				{
+					f(entity, std::get<Storage<Viewed> const*>(storages)->at(entity)...);
+				}
+			}
+		}
+
+	private:
+		std::tuple<Storage<Viewed> const*...> storages;
+	};
+
+	template <typename Component>
+	Storage<Component>& storage()
+	{
+		static_assert(isKnown<Component>, "component type is not part of this StaticWorld");
+		return std::get<Storage<Component>>(storages);
+	}
+
+	template <typename Component>
+	Storage<Component> const& storage() const
+	{
+		static_assert(isKnown<Component>, "component type is not part of this StaticWorld");
+		return std::get<Storage<Component>>(storages);
+	}
+
+	std::vector<unsigned> generations;
+	std::vector<unsigned> freeIds;
+	std::size_t aliveCount = 0;
+	std::tuple<Storage<Components>...> storages;
+};
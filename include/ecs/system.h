@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "sdlpp/events.h"
 
+#include "ecs/thread_pool.h"
 #include "ecs/world.h"
 
 enum class DidConsume: bool
@@ -9,6 +16,21 @@ enum class DidConsume: bool
 	No, Yes
 };
 
+// The key events are routed by: the active alternative for variant-style
+// event wrappers, the raw type field for union-style ones.
+template <typename Event>
+std::size_t eventTypeOf(Event const& event)
+{
+	if constexpr (requires { event.index(); })
+	{
+		return event.index();
+	}
+	else
+	{
+		return static_cast<std::size_t>(event.type);
+	}
+}
+
 class System
 {
 public:
@@ -23,8 +45,156 @@ public:
 	System& operator=(System&&) = delete;
 
 	virtual void update() {}
-	virtual DidConsume tryConsumeEvent(SDL::Event) { return DidConsume::No; }
+	virtual DidConsume tryConsumeEvent(SDL::Event const&) { return DidConsume::No; }
+
+	// Component families this system's update() reads or writes; the
+	// scheduler uses these to decide which systems may run concurrently.
+	virtual std::vector<unsigned> reads() const { return {}; }
+	virtual std::vector<unsigned> writes() const { return {}; }
 
 protected:
+	template <typename... Components>
+	static std::vector<unsigned> accessSet()
+	{
+		return {ComponentFamily::id<Components>()...};
+	}
+
 	World& world;
 };
+
+// Owns registered systems and runs non-conflicting ones concurrently.
+// Systems are partitioned into waves: a system lands in the wave after the
+// last earlier system whose writes overlap its access set (or vice versa),
+// so conflicting systems keep their registration order.
+class SystemScheduler
+{
+public:
+	void add(std::unique_ptr<System> system)
+	{
+		systems.push_back(std::move(system));
+		wavesDirty = true;
+	}
+
+	template <typename S, typename... Args>
+	S& emplace(Args&&... args)
+	{
+		auto system = std::make_unique<S>(std::forward<Args>(args)...);
+		auto& reference = *system;
+		add(std::move(system));
+		return reference;
+	}
+
+	void update()
+	{
+		if (wavesDirty)
+		{
+			buildWaves();
+		}
+		for (auto& wave: waves)
+		{
+			if (wave.size() == 1)
+			{
+				wave.front()->update();
+				continue;
+			}
+			ThreadPool::shared().parallelFor(wave.size(), 1,
+				[&wave](std::size_t begin, std::size_t end)
+				{
+					for (auto index = begin; index < end; ++index)
+					{
+						wave[index]->update();
+					}
+				});
+		}
+	}
+
+	// Systems that want input events register here against the event types
+	// they handle; unregistered systems are never polled. Lower priority
+	// values are asked first, ties keep registration order.
+	void registerEventHandler(std::size_t eventType, System& system, int priority = 0)
+	{
+		auto& handlers = eventHandlers[eventType];
+		auto position = std::find_if(handlers.begin(), handlers.end(),
+			[priority](Handler const& handler) { return priority < handler.priority; });
+		handlers.insert(position, {priority, &system});
+	}
+
+	// Dispatches the event to the systems registered for its type only,
+	// by reference, stopping at the first one that consumes it.
+	DidConsume tryConsumeEvent(SDL::Event const& event)
+	{
+		auto found = eventHandlers.find(eventTypeOf(event));
+		if (found == eventHandlers.end())
+		{
+			return DidConsume::No;
+		}
+		for (auto& handler: found->second)
+		{
+			if (handler.system->tryConsumeEvent(event) == DidConsume::Yes)
+			{
+				return DidConsume::Yes;
+			}
+		}
+		return DidConsume::No;
+	}
+
+private:
+	struct Handler
+	{
+		int priority;
+		System* system;
+	};
+	struct AccessSet
+	{
+		std::vector<unsigned> reads;
+		std::vector<unsigned> writes;
+	};
+
+	static bool overlaps(std::vector<unsigned> const& a, std::vector<unsigned> const& b)
+	{
+		return std::any_of(a.begin(), a.end(),
+			[&b](unsigned family)
+			{
+				return std::find(b.begin(), b.end(), family) != b.end();
+			});
+	}
+
+	static bool conflicts(AccessSet const& a, AccessSet const& b)
+	{
+		return overlaps(a.writes, b.writes)
+			|| overlaps(a.writes, b.reads)
+			|| overlaps(a.reads, b.writes);
+	}
+
+	void buildWaves()
+	{
+		waves.clear();
+		std::vector<AccessSet> accessSets;
+		std::vector<std::size_t> waveOf;
+		for (auto& system: systems)
+		{
+			auto access = AccessSet{system->reads(), system->writes()};
+			std::size_t wave = 0;
+			for (std::size_t earlier = 0; earlier < accessSets.size(); ++earlier)
+			{
+				if (conflicts(access, accessSets[earlier]))
+				{
+					wave = std::max(wave, waveOf[earlier] + 1);
+				}
+			}
+			if (wave >= waves.size())
+			{
+				waves.resize(wave + 1);
+			}
+			waves[wave].push_back(system.get());
+			waveOf.push_back(wave);
+			accessSets.push_back(std::move(access));
+		}
+		wavesDirty = false;
+	}
+
+	std::vector<std::unique_ptr<System>> systems;
+	std::vector<std::vector<System*>> waves;
+	std::unordered_map<std::size_t, std::vector<Handler>> eventHandlers;
+	bool wavesDirty = false;
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool
+{
+public:
+	explicit ThreadPool(unsigned threadCount = std::thread::hardware_concurrency())
+	{
+		if (threadCount == 0)
+		{
+			threadCount = 1;
+		}
+		for (unsigned i = 0; i < threadCount; ++i)
+		{
+			workers.emplace_back([this] { workerLoop(); });
+		}
+	}
+
+	~ThreadPool()
+	{
+		{
+			std::scoped_lock lock{mutex};
+			stopping = true;
+		}
+		condition.notify_all();
+		for (auto& worker: workers)
+		{
+			worker.join();
+		}
+	}
+
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	static ThreadPool& shared()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	std::size_t threadCount() const
+	{
+		return workers.size();
+	}
+
+	// Splits [0, count) into fixed-size chunks and runs f(begin, end) over
+	// them on the worker threads plus the calling thread. Chunks are claimed
+	// from a shared atomic counter, so workers that finish early steal the
+	// remaining chunks from slower ones.
+	template <typename Callable>
+	void parallelFor(std::size_t count, std::size_t chunkSize, Callable f)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+		chunkSize = std::max<std::size_t>(chunkSize, 1);
+		auto chunkCount = (count + chunkSize - 1) / chunkSize;
+		std::atomic<std::size_t> nextChunk{0};
+		auto runChunks = [&]
+		{
+			for (auto chunk = nextChunk.fetch_add(1); chunk < chunkCount; chunk = nextChunk.fetch_add(1))
+			{
+				auto begin = chunk * chunkSize;
+				f(begin, std::min(begin + chunkSize, count));
+			}
+		};
+		auto helperCount = std::min(workers.size(), chunkCount - 1);
+		std::latch helpersDone{static_cast<std::ptrdiff_t>(helperCount)};
+		for (std::size_t i = 0; i < helperCount; ++i)
+		{
+			post([&]
+			{
+				runChunks();
+				helpersDone.count_down();
+			});
+		}
+		runChunks();
+		// Drain the queue instead of blocking on the latch: a chunk body may
+		// itself call parallelFor (the scheduler runs systems through here,
+		// and systems use each_parallel), and a worker that blocked with its
+		// nested helpers still queued behind it would deadlock the pool once
+		// every worker is in that state.
+		while (not helpersDone.try_wait())
+		{
+			if (not runOneTask())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+private:
+	void post(std::function<void()> task)
+	{
+		{
+			std::scoped_lock lock{mutex};
+			tasks.push_back(std::move(task));
+		}
+		condition.notify_one();
+	}
+
+	bool runOneTask()
+	{
+		std::function<void()> task;
+		{
+			std::scoped_lock lock{mutex};
+			if (tasks.empty())
+			{
+				return false;
+			}
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+		task();
+		return true;
+	}
+
+	void workerLoop()
+	{
+		for (;;)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock lock{mutex};
+				condition.wait(lock, [this] { return stopping || not tasks.empty(); });
+				if (stopping && tasks.empty())
+				{
+					return;
+				}
+				task = std::move(tasks.front());
+				tasks.pop_front();
+			}
+			task();
+		}
+	}
+
+	std::vector<std::thread> workers;
+	std::deque<std::function<void()>> tasks;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool stopping = false;
+};
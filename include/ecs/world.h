@@ -1,34 +1,158 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <cstdint>
 #include <functional>
-#include <map>
+#include <iterator>
+#include <limits>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <shared_mutex>
+#include <span>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <vector>
 
-#include <DU/type_utils.h>
+#ifdef ECS_INSTRUMENTATION
+#include <chrono>
+#endif
+
+#include "ecs/delegate.h"
+#include "ecs/thread_pool.h"
 
 struct Entity
 {
 	unsigned entityId;
-	friend auto operator<=>(Entity const&, Entity const&) = default; 
+	unsigned generation = 0;
+	friend auto operator<=>(Entity const&, Entity const&) = default;
 };
 
 template <typename F, typename T>
 concept TakesOnlyLvalue = std::is_invocable_v<F, T&> && not std::is_invocable_v<F, T>;
 
+// Marks component types a view must not see: world.view<A>(exclude<B>).
+template <typename... Components>
+struct Exclude {};
+
+template <typename... Components>
+inline constexpr Exclude<Components...> exclude{};
+
+// std::shared_mutex is neither copyable nor movable; this wrapper copies and
+// moves as a fresh, unlocked mutex, so the classes holding one keep their
+// implicit special members.
+struct CopyableSharedMutex: std::shared_mutex
+{
+	CopyableSharedMutex() = default;
+	CopyableSharedMutex(CopyableSharedMutex const&): std::shared_mutex{} {}
+	CopyableSharedMutex& operator=(CopyableSharedMutex const&) { return *this; }
+};
+
+// One word of the per-entity signature bitset. Presence tests (views,
+// WorldView::has) read these words while a writer holding only its own
+// storages' locks flips bits in them, so each word is a relaxed atomic: the
+// storage mutexes order the component data itself, the signature is only a
+// filter hint. Copies transfer the value into a fresh atomic, keeping the
+// vector holding them copyable.
+struct SignatureWord
+{
+	SignatureWord(std::uint64_t value_ = 0): value{value_} {}
+	SignatureWord(SignatureWord const& other): value{other.load()} {}
+
+	SignatureWord& operator=(SignatureWord const& other)
+	{
+		value.store(other.load(), std::memory_order_relaxed);
+		return *this;
+	}
+
+	SignatureWord& operator=(std::uint64_t newValue)
+	{
+		value.store(newValue, std::memory_order_relaxed);
+		return *this;
+	}
+
+	SignatureWord& operator|=(std::uint64_t bits)
+	{
+		value.fetch_or(bits, std::memory_order_relaxed);
+		return *this;
+	}
+
+	SignatureWord& operator&=(std::uint64_t bits)
+	{
+		value.fetch_and(bits, std::memory_order_relaxed);
+		return *this;
+	}
+
+	std::uint64_t load() const
+	{
+		return value.load(std::memory_order_relaxed);
+	}
+
+	operator std::uint64_t() const
+	{
+		return load();
+	}
+
+	std::atomic<std::uint64_t> value;
+};
+
+// One storage's worth of diagnostics, as reported by World::stats(). The
+// structural fields (entityCount, bytesUsed) are always available; the
+// hot-path counters are only maintained when the build defines
+// ECS_INSTRUMENTATION and read as zero otherwise, so shipping builds pay
+// nothing for them.
+struct StorageStats
+{
+	std::size_t entityCount = 0;
+	std::size_t bytesUsed = 0;
+	std::uint64_t inserts = 0;
+	std::uint64_t erases = 0;
+	std::uint64_t lookups = 0;
+	std::uint64_t eventPublishes = 0;
+	std::uint64_t eachCalls = 0;
+	std::uint64_t eachTimeNs = 0;
+};
+
+// Assigns each component type a small dense index on first use, so storage
+// lookup is a direct array index instead of a typeid hash and map probe.
+class ComponentFamily
+{
+public:
+	template <typename Component>
+	static unsigned id()
+	{
+		static unsigned const familyId = nextFamilyId++;
+		return familyId;
+	}
+
+private:
+	static inline unsigned nextFamilyId = 0;
+};
+
 class World
 {
 public:
+	// Mutation through a dead handle — stale after destroyEntity, or from
+	// another world entirely — is ignored, like destroyEntity: writing
+	// through one would corrupt whatever entity has recycled the slot.
 	template <typename Component, typename... Ts>
 	void assign(Entity entity, Ts&&... args)
 	{
+		if (not isAlive(entity))
+		{
+			return;
+		}
 		ensureStorage<Component>();
 		bool isCreated = not has<Component>(entity);
 		getStorage<Component>().insert_or_assign(entity, Component{args...});
+		signatures[entity.entityId] |= signatureBit<Component>();
 		if (isCreated)
 		{
 			onCreate<Component>().publish(*this, entity);
@@ -43,8 +167,14 @@ public:
 	void transform(Entity entity, Callable f)
 		requires requires (Component& c) { c = f(c); }
 	{
-		auto& component = getStorage<Component>().at(entity);
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		auto& storage = getStorage<Component>();
+		auto& component = storage.at(entity);
 		component = f(component);
+		storage.touch(entity);
 		onUpdate<Component>().publish(*this, entity);
 	}
 
@@ -52,259 +182,1724 @@ public:
 	void patch(Entity entity, Callable f)
 		requires TakesOnlyLvalue<Callable, Component>
 	{
-		auto& component = getStorage<Component>().at(entity);
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		auto& storage = getStorage<Component>();
+		auto& component = storage.at(entity);
 		f(component);
+		storage.touch(entity);
 		onUpdate<Component>().publish(*this, entity);
 	}
 
+	// Storage-wide batch updates: one storage resolution, a tight loop over
+	// the packed component array, and a single storage-level bulk-updated
+	// event (onBulkUpdate) instead of per-entity dispatch.
+	template <typename Component, typename Callable>
+	void patchAll(Callable f)
+		requires TakesOnlyLvalue<Callable, Component>
+	{
+		if (not hasStorage<Component>())
+		{
+			return;
+		}
+		auto& storage = getStorage<Component>();
+		for (auto& component: storage.components)
+		{
+			f(component);
+		}
+		++storage.currentVersion;
+		std::fill(storage.versions.begin(), storage.versions.end(), storage.currentVersion);
+		storage.bulkUpdateEventDispatcher.publish(*this);
+	}
+
+	template <typename Component, typename Callable>
+	void transformAll(Callable f)
+		requires requires (Component& c) { c = f(c); }
+	{
+		if (not hasStorage<Component>())
+		{
+			return;
+		}
+		auto& storage = getStorage<Component>();
+		for (auto& component: storage.components)
+		{
+			component = f(component);
+		}
+		++storage.currentVersion;
+		std::fill(storage.versions.begin(), storage.versions.end(), storage.currentVersion);
+		storage.bulkUpdateEventDispatcher.publish(*this);
+	}
+
+	// Requires the entity to have the component — asserted in debug builds,
+	// undefined otherwise. Reach for try_get when presence is in question.
 	template <typename Component>
 	Component const& get(Entity entity) const
 	{
 		return getStorage<Component>().at(entity);
 	}
 
+	// Single-lookup access: nullptr instead of a throw on the miss path, so
+	// the usual has-then-get pattern costs one storage probe instead of two.
 	template <typename Component>
-	void remove(Entity entity)
+	Component const* try_get(Entity entity) const
 	{
-		onRemove<Component>().publish(*this, entity);
-		getStorage<Component>().erase(entity);
+		if (not isAlive(entity) || not hasStorage<Component>())
+		{
+			return nullptr;
+		}
+		return getStorage<Component>().find(entity);
 	}
 
-	std::size_t size() const
+	// Resolves each storage once and returns a tuple of pointers, null where
+	// the entity lacks that component.
+	template <typename... Components>
+	std::tuple<Components const*...> getMany(Entity entity) const
 	{
-		return entities.size();
+		return {try_get<Components>(entity)...};
 	}
 
-	Entity createEntity()
+	// The packed component array itself, for SIMD and other bulk numeric
+	// kernels; rawEntities<Component>() is the matching entity array, index
+	// for index. The spans alias live storage, so any structural change
+	// (assign of a new component, remove, destroyEntity) invalidates them,
+	// and writes through the span bypass change tracking and update events —
+	// follow them with patchAll or touch when observers matter. Alignment is
+	// the component's own: declare the component alignas(32) (or 64) and the
+	// array is allocated over-aligned for the matching vector width.
+	template <typename Component>
+		requires (not std::is_empty_v<Component>)
+	std::span<Component> raw()
 	{
-		auto newEntity = Entity{nextEntityId++};
-		entities.insert(newEntity);
-		return newEntity;
+		if (not hasStorage<Component>())
+		{
+			return {};
+		}
+		auto& storage = getStorage<Component>();
+		return {storage.components.data(), storage.components.size()};
 	}
 
-	void destroyEntity(Entity entity)
+	template <typename Component>
+		requires (not std::is_empty_v<Component>)
+	std::span<Component const> raw() const
 	{
-		for (auto&& [_, storage]: componentStorage)
+		if (not hasStorage<Component>())
 		{
-			storage->erase(entity);
+			return {};
 		}
-		entities.erase(entity);
+		auto& storage = getStorage<Component>();
+		return {storage.components.data(), storage.components.size()};
 	}
 
 	template <typename Component>
-	bool has(Entity entity) const
+	std::span<Entity const> rawEntities() const
 	{
 		if (not hasStorage<Component>())
 		{
-			return false;
+			return {};
 		}
-		return getStorage<Component>().contains(entity);
+		auto& storage = getStorage<Component>();
+		return {storage.entities.data(), storage.entities.size()};
 	}
 
-	template <typename... Components>
-	auto view() const
+	template <typename Component>
+	void remove(Entity entity)
 	{
-		if (not (hasStorage<Components>() && ...))
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		onRemove<Component>().publish(*this, entity);
+		getStorage<Component>().erase(entity);
+		if (entity.entityId < signatures.size())
 		{
-			return View<Components...>{Storage<Components>{}...};
+			signatures[entity.entityId] &= ~signatureBit<Component>();
 		}
-		return View<Components...>{getStorage<Components>()...};
 	}
 
-	template <typename Component>
-	auto& onCreate()
+	std::size_t size() const
 	{
-		ensureStorage<Component>();
-		return getStorage<Component>().createEventDispatcher;
+		return aliveCount;
 	}
 
-	template <typename Component>
-	auto& onUpdate()
+	Entity createEntity()
 	{
-		ensureStorage<Component>();
-		return getStorage<Component>().updateEventDispatcher;
+		if (not freeIds.empty())
+		{
+			auto id = freeIds.back();
+			freeIds.pop_back();
+			++aliveCount;
+			return Entity{id, generations[id]};
+		}
+		auto id = static_cast<unsigned>(generations.size());
+		generations.push_back(0);
+		signatures.push_back(0);
+		++aliveCount;
+		return Entity{id};
+	}
+
+	// Creates count entities with contiguous ids in one pre-sized batch,
+	// bypassing the free list so the returned range is always contiguous.
+	std::vector<Entity> createEntities(std::size_t count)
+	{
+		std::vector<Entity> created;
+		created.reserve(count);
+		generations.reserve(generations.size() + count);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			auto id = static_cast<unsigned>(generations.size());
+			generations.push_back(0);
+			created.push_back(Entity{id});
+		}
+		signatures.resize(generations.size(), 0);
+		aliveCount += count;
+		return created;
 	}
 
+	// Bulk assign: one storage resolution and one pre-sized insertion batch
+	// for the whole range. Events still describe every entity, but are
+	// skipped entirely when nobody is connected (and collapse into a single
+	// batched pass when the dispatcher is deferred).
 	template <typename Component>
-	auto& onRemove()
+	void assign(std::span<Entity const> range, Component const& prototype)
+	{
+		assign<Component>(range, [&prototype](Entity) { return prototype; });
+	}
+
+	template <typename Component, typename Generator>
+	void assign(std::span<Entity const> range, Generator generate)
+		requires std::is_invocable_r_v<Component, Generator, Entity>
 	{
 		ensureStorage<Component>();
-		return getStorage<Component>().removeEventDispatcher;
+		auto& storage = getStorage<Component>();
+		storage.reserve(storage.entities.size() + range.size());
+		auto& created = storage.createEventDispatcher;
+		auto& updated = storage.updateEventDispatcher;
+		for (auto entity: range)
+		{
+			if (not isAlive(entity))
+			{
+				continue;
+			}
+			bool isCreated = not storage.contains(entity);
+			storage.insert_or_assign(entity, generate(entity));
+			signatures[entity.entityId] |= signatureBit<Component>();
+			if (isCreated)
+			{
+				if (not created.callbacks.empty() || created.deferred)
+				{
+					created.publish(*this, entity);
+				}
+			}
+			else if (not updated.callbacks.empty() || updated.deferred)
+			{
+				updated.publish(*this, entity);
+			}
+		}
 	}
 
-private:
-	unsigned nextEntityId = 0;
+	void destroyEntity(Entity entity)
+	{
+		if (not isAlive(entity))
+		{
+			return;
+		}
+		for (std::size_t familyId = 0; familyId < componentStorage.size(); ++familyId)
+		{
+			auto& slot = componentStorage[familyId];
+			if (slot && slot->contains(entity))
+			{
+				mutableStorage(familyId).erase(*this, entity);
+			}
+		}
+		// Bumping the generation invalidates every outstanding handle to
+		// this slot before the id goes back on the free list.
+		signatures[entity.entityId] = 0;
+		++generations[entity.entityId];
+		freeIds.push_back(entity.entityId);
+		--aliveCount;
+	}
 
-	struct StorageBase
+	// Permutes the packed storage in place so traversal follows the order
+	// the comparator defines (texture order, spatial order, ...), keeping
+	// the sparse index consistent. Must not be used on storages owned by a
+	// group — the group prefix relies on its own ordering.
+	template <typename Component, typename Compare>
+	void sort(Compare compare)
+		requires std::is_invocable_r_v<bool, Compare, Component const&, Component const&>
 	{
-		virtual ~StorageBase() = default;
+		if (not hasStorage<Component>())
+		{
+			return;
+		}
+		getStorage<Component>().sort(compare);
+	}
 
-		virtual void erase(Entity) = 0;
+	// Pre-grows a component's dense arrays and sparse pages, e.g. at level
+	// load, so the first spawn wave pays no allocation cost.
+	template <typename Component>
+	void reserve(std::size_t capacity)
+	{
+		ensureStorage<Component>();
+		getStorage<Component>().reserve(capacity);
+	}
 
-		std::set<Entity> entities;
-	};
+	// Near-O(1) copy for rollback and prediction: the clone shares every
+	// storage with this world and either side detaches its private copy of
+	// a storage on first mutation. Views and groups taken from one world
+	// before a mutation must not be reused afterwards.
+	World clone() const
+	{
+		World copy;
+		copy.generations = generations;
+		copy.freeIds = freeIds;
+		copy.signatures = signatures;
+		copy.aliveCount = aliveCount;
+		copy.groupSizes = groupSizes;
+		copy.componentStorage = componentStorage;
+		return copy;
+	}
 
-	template <typename Component>
-	struct Storage: public StorageBase, public std::map<Entity, Component>
+	// Moves an entity into another world — all components in one pass over
+	// the storages, no per-type knowledge needed — and returns its handle
+	// there. The source entity is destroyed; remove events fire here and
+	// create events in the target, so groups on both sides stay consistent.
+	// Migrating a dead handle is a no-op that returns it unchanged.
+	Entity migrate(Entity entity, World& target)
 	{
-		void erase(Entity entity) override
+		if (not isAlive(entity))
 		{
-			std::map<Entity, Component>::erase(entity);
-			entities.erase(entity);
+			return entity;
 		}
-
-		void insert_or_assign(Entity entity, Component component)
+		auto migrated = target.createEntity();
+		for (std::size_t familyId = 0; familyId < componentStorage.size(); ++familyId)
 		{
-			std::map<Entity, Component>::insert_or_assign(entity, component);
-			entities.insert(entity);
+			auto& slot = componentStorage[familyId];
+			if (slot && slot->contains(entity))
+			{
+				mutableStorage(familyId).moveTo(*this, entity, target, migrated);
+			}
 		}
+		destroyEntity(entity);
+		return migrated;
+	}
 
-		struct EventDispatcher
+	// Batched region migration, storage-major: each storage is resolved once
+	// and walked over the whole batch, which is the cheap way to rebalance
+	// thousands of entities between shards. Dead handles are skipped; the
+	// returned entities parallel the live inputs in order.
+	std::vector<Entity> migrate(std::span<Entity const> range, World& target)
+	{
+		std::vector<Entity> sources;
+		std::vector<Entity> migrated;
+		sources.reserve(range.size());
+		migrated.reserve(range.size());
+		for (auto entity: range)
 		{
-			unsigned nextCallbackId = 0;
-
-			using Callback = std::function<void(World&, Entity)>;
-
-			unsigned connect(Callback f)
+			if (isAlive(entity))
 			{
-				auto id = nextCallbackId++;
-				callbacks[id] = f;
-				return id;
+				sources.push_back(entity);
+				migrated.push_back(target.createEntity());
 			}
-			
-			void disconnect(unsigned callbackId)
+		}
+		for (std::size_t familyId = 0; familyId < componentStorage.size(); ++familyId)
+		{
+			auto& slot = componentStorage[familyId];
+			if (not slot)
 			{
-				callbacks.erase(callbackId);
+				continue;
 			}
-
-			void publish(World& world, Entity entity)
+			// Probe through the shared pointer first, so storages the batch
+			// never touches are not detached from copy-on-write clones.
+			if (not std::any_of(sources.begin(), sources.end(),
+				[&slot](Entity entity) { return slot->contains(entity); }))
 			{
-				for (auto& item: callbacks)
-				{
-					auto& callback = item.second;
-					callback(world, entity);
-				}
+				continue;
 			}
+			auto& storage = mutableStorage(familyId);
+			for (std::size_t i = 0; i < sources.size(); ++i)
+			{
+				storage.moveTo(*this, sources[i], target, migrated[i]);
+			}
+		}
+		for (auto entity: sources)
+		{
+			destroyEntity(entity);
+		}
+		return migrated;
+	}
 
-			std::unordered_map<unsigned, Callback> callbacks;
-		};
-
-		EventDispatcher createEventDispatcher;
-		EventDispatcher updateEventDispatcher;
-		EventDispatcher removeEventDispatcher;
-	};
-
-	std::set<Entity> entities;
-	std::unordered_map<std::type_index, std::unique_ptr<StorageBase>> componentStorage;
+	bool isAlive(Entity entity) const
+	{
+		return entity.entityId < generations.size()
+			&& generations[entity.entityId] == entity.generation;
+	}
 
 	template <typename Component>
-	void ensureStorage()
+	bool has(Entity entity) const
 	{
-		if (not hasStorage<Component>())
+		if (not isAlive(entity))
+		{
+			return false;
+		}
+		if (auto bit = signatureBit<Component>(); bit != 0)
 		{
-			componentStorage[typeid(Component)].reset(new Storage<Component>{});
+			return (signatures[entity.entityId] & bit) != 0;
 		}
+		return hasStorage<Component>() && getStorage<Component>().contains(entity);
+	}
+
+	template <typename... Components, typename... Excluded>
+	auto view(Exclude<Excluded...> = {}) const
+	{
+		return View<Exclude<Excluded...>, Components...>{this, storagePointer<Components>()...};
 	}
 
+	// Diagnostics for one component's storage, cheap enough to sample every
+	// frame and ship to a metrics pipeline. The structural fields are always
+	// live; the counters need the build to define ECS_INSTRUMENTATION (see
+	// StorageStats) and come back as zero otherwise.
 	template <typename Component>
-	auto& getStorage()
+	StorageStats stats() const
 	{
-		return *static_cast<Storage<Component>*>(componentStorage.at(typeid(Component)).get());
+		auto result = StorageStats{};
+		if (not hasStorage<Component>())
+		{
+			return result;
+		}
+		auto& storage = getStorage<Component>();
+		result.entityCount = storage.entities.size();
+		result.bytesUsed = storage.entities.capacity() * sizeof(Entity)
+			+ storage.components.capacity() * sizeof(Component)
+			+ storage.versions.capacity() * sizeof(std::uint64_t);
+		for (auto& page: storage.sparsePages)
+		{
+			if (page)
+			{
+				result.bytesUsed += sizeof(*page);
+			}
+		}
+#ifdef ECS_INSTRUMENTATION
+		result.inserts = storage.inserts.load(std::memory_order_relaxed);
+		result.erases = storage.erases.load(std::memory_order_relaxed);
+		result.lookups = storage.lookups.load(std::memory_order_relaxed);
+		result.eventPublishes = storage.createEventDispatcher.publishes
+			+ storage.updateEventDispatcher.publishes
+			+ storage.removeEventDispatcher.publishes
+			+ storage.bulkUpdateEventDispatcher.publishes;
+		result.eachCalls = storage.eachCalls.load(std::memory_order_relaxed);
+		result.eachTimeNs = storage.eachTimeNs.load(std::memory_order_relaxed);
+#endif
+		return result;
 	}
-	
+
+	// The storage's current change version; capture it after a system runs
+	// and pass it back to modified() next tick to see only what changed.
 	template <typename Component>
-	auto const& getStorage() const
+	std::uint64_t version() const
 	{
-		return *static_cast<Storage<Component>*>(componentStorage.at(typeid(Component)).get());
+		if (not hasStorage<Component>())
+		{
+			return 0;
+		}
+		return getStorage<Component>().currentVersion;
 	}
-	
+
+	// A view over the entities whose Component changed after sinceVersion.
 	template <typename Component>
-	bool hasStorage() const
+	auto modified(std::uint64_t sinceVersion) const
 	{
-		return componentStorage.contains(typeid(Component));
+		return ModifiedView<Component>{storagePointer<Component>(), sinceVersion};
 	}
-	
+
+	// Owning groups keep the matching entities packed at the front of every
+	// member storage, co-sorted so the same entity sits at the same dense
+	// index in each of them. A storage can belong to at most one group.
 	template <typename... Components>
-	class View
+	auto group()
 	{
-	public:
-		View(Storage<Components>... storages_)
+		static_assert(sizeof...(Components) > 0);
+		(ensureStorage<Components>(), ...);
+		auto key = std::type_index{typeid(Group<Components...>)};
+		if (not groupSizes.contains(key))
 		{
-			(storages.insert({typeid(Components), std::make_unique<Storage<Components>>(std::move(storages_))}), ...);
+			groupSizes.emplace(key, 0);
+			(onCreate<Components>().connect([](World& world, Entity entity)
+			{
+				world.groupTryAdd<Components...>(entity);
+			}), ...);
+			(onRemove<Components>().connect([](World& world, Entity entity)
+			{
+				world.groupTryRemove<Components...>(entity);
+			}), ...);
+			using First = std::tuple_element_t<0, std::tuple<Components...>>;
+			auto candidates = getStorage<First>().entities;
+			for (auto entity: candidates)
+			{
+				groupTryAdd<Components...>(entity);
+			}
 		}
+		return Group<Components...>{&groupSizes.at(key), &getStorage<Components>()...};
+	}
 
-		template <typename Callable>
-		void each(Callable f)
+	template <typename Component>
+	auto& onCreate()
+	{
+		ensureStorage<Component>();
+		return getStorage<Component>().createEventDispatcher;
+	}
+
+	template <typename Component>
+	auto& onUpdate()
+	{
+		ensureStorage<Component>();
+		return getStorage<Component>().updateEventDispatcher;
+	}
+
+	template <typename Component>
+	auto& onRemove()
+	{
+		ensureStorage<Component>();
+		return getStorage<Component>().removeEventDispatcher;
+	}
+
+	template <typename Component>
+	auto& onBulkUpdate()
+	{
+		ensureStorage<Component>();
+		return getStorage<Component>().bulkUpdateEventDispatcher;
+	}
+
+	// Dispatches all events held back by dispatchers in deferred mode.
+	void flushEvents()
+	{
+		for (std::size_t familyId = 0; familyId < componentStorage.size(); ++familyId)
 		{
-			auto& base = storages.begin()->second;
-			for (auto entity: base->entities)
+			auto& slot = componentStorage[familyId];
+			if (slot && slot->hasPendingEvents())
 			{
-				if ((getStorage<Components>().contains(entity) && ...))
-				{
-					f(entity, getStorage<Components>().at(entity)...);
-				}
+				mutableStorage(familyId).flushEvents(*this);
 			}
 		}
+	}
 
-		class Iterator
+	// Concurrency. The hot paths stay unsynchronized; threads that share a
+	// world follow a locking discipline instead. The simulation thread wraps
+	// component mutation in writeAccess<Ts...>() and structural changes
+	// (createEntity, destroyEntity, group creation) in structuralAccess();
+	// worker threads read through a WorldView, whose per-entity accessors
+	// lock on their own, and hold readAccess<Ts...>() across any view()
+	// iteration. Storage locks are always taken in family-id order, so
+	// nested guards cannot deadlock. The per-entity signature words are
+	// relaxed atomics (see SignatureWord), so a writer flipping presence
+	// bits under its own storage locks does not race readers filtering on
+	// unrelated components. Worlds cloned from a world that worker threads
+	// are reading must stay on a single thread.
+	class ReadAccess
+	{
+	public:
+		ReadAccess(World const& world, std::vector<std::shared_mutex*> const& mutexes)
+			: entityLock{world.entityMutex}
 		{
-		public:
-			Iterator(View<Components...>* container_, std::set<Entity>::iterator iterator, std::set<Entity>::iterator end)
-				: container{container_}
-				, entityIterator{iterator}
-				, endIterator{end}
-			{}
-
-			auto operator*()
+			storageLocks.reserve(mutexes.size());
+			for (auto* mutex: mutexes)
 			{
-				auto entity = *entityIterator;
-				return std::tie(entity, container->getStorage<Components>().at(entity)...);
+				storageLocks.emplace_back(*mutex);
 			}
+		}
 
-			bool operator!=(Iterator const& other) const
-			{
-				return entityIterator != other.entityIterator;
-			}
+	private:
+		std::shared_lock<std::shared_mutex> entityLock;
+		std::vector<std::shared_lock<std::shared_mutex>> storageLocks;
+	};
+
+	class WriteAccess
+	{
+	public:
+		WriteAccess(World& world, std::vector<std::shared_mutex*> const& mutexes)
+			: entityLock{world.entityMutex}
+		{
+			storageLocks.reserve(mutexes.size());
+			for (auto* mutex: mutexes)
+			{
+				storageLocks.emplace_back(*mutex);
+			}
+		}
+
+	private:
+		// Shared on the entity table: component writes do not change it, the
+		// lock only keeps structural changes out while the guard is held.
+		std::shared_lock<std::shared_mutex> entityLock;
+		std::vector<std::unique_lock<std::shared_mutex>> storageLocks;
+	};
+
+	class StructuralAccess
+	{
+	public:
+		explicit StructuralAccess(World& world)
+			: entityLock{world.entityMutex}
+		{
+			storageLocks.reserve(world.componentStorage.size());
+			for (auto& slot: world.componentStorage)
+			{
+				if (slot)
+				{
+					storageLocks.emplace_back(slot->storageMutex);
+				}
+			}
+		}
+
+	private:
+		std::unique_lock<std::shared_mutex> entityLock;
+		std::vector<std::unique_lock<std::shared_mutex>> storageLocks;
+	};
+
+	template <typename... Components>
+	ReadAccess readAccess() const
+	{
+		return ReadAccess{*this, storageMutexes<Components...>()};
+	}
+
+	template <typename... Components>
+	WriteAccess writeAccess()
+	{
+		{
+			std::unique_lock tableLock{entityMutex};
+			(ensureStorage<Components>(), ...);
+			// Detach copy-on-write storages up front, so the locks taken
+			// below belong to the storages the writes will actually touch.
+			(static_cast<void>(getStorage<Components>()), ...);
+		}
+		return WriteAccess{*this, storageMutexes<Components...>()};
+	}
+
+	StructuralAccess structuralAccess()
+	{
+		return StructuralAccess{*this};
+	}
+
+private:
+	friend class Snapshot;
+
+	struct StorageBase
+	{
+		virtual ~StorageBase() = default;
+
+		virtual void erase(Entity) = 0;
+		virtual void erase(World&, Entity) = 0;
+		// Moves this storage's component for entity into the target world's
+		// matching storage, publishing the remove in the source and the
+		// create in the target so group prefixes on both sides stay
+		// maintained.
+		virtual void moveTo(World& source, Entity entity, World& target, Entity targetEntity) = 0;
+		virtual void flushEvents(World&) = 0;
+		virtual bool contains(Entity) const = 0;
+		virtual bool hasPendingEvents() const = 0;
+		virtual std::shared_ptr<StorageBase> cloneStorage() const = 0;
+
+		std::vector<Entity> entities;
+		mutable CopyableSharedMutex storageMutex;
+	};
+
+	// Tags (empty component types) get a zero-footprint stand-in for the
+	// dense component array: only the element count is tracked and every
+	// access yields one shared instance, so a marker like Frozen or Dead
+	// costs no per-entity component storage at all. The begin/end range is
+	// empty — there is no state for batch updates to touch.
+	template <typename Component>
+	struct TagArray
+	{
+		inline static Component instance{};
+
+		std::size_t size() const { return count; }
+		std::size_t capacity() const { return 0; }
+		void reserve(std::size_t) {}
+		void resize(std::size_t newCount) { count = newCount; }
+		void push_back(Component const&) { ++count; }
+		void pop_back() { --count; }
+		Component& operator[](std::size_t) { return instance; }
+		Component const& operator[](std::size_t) const { return instance; }
+		Component* begin() { return &instance; }
+		Component* end() { return &instance; }
+		Component const* begin() const { return &instance; }
+		Component const* end() const { return &instance; }
+
+		std::size_t count = 0;
+	};
+
+	template <typename Component>
+	struct Storage: public StorageBase
+	{
+		// The entity-id -> dense-index map is a paged sparse array: fixed
+		// size pages allocated on first touch and kept for reuse afterwards,
+		// so steady-state insert/erase churn never hits the heap.
+		static constexpr std::size_t sparsePageSize = 4096;
+		static constexpr std::size_t missing = std::numeric_limits<std::size_t>::max();
+
+		std::conditional_t<std::is_empty_v<Component>,
+			TagArray<Component>, std::vector<Component>> components;
+		std::vector<std::unique_ptr<std::array<std::size_t, sparsePageSize>>> sparsePages;
+
+		// Change tracking: every mutation stamps the element with the next
+		// value of a per-storage counter, so "changed since" queries are a
+		// single comparison per element.
+		std::uint64_t currentVersion = 0;
+		std::vector<std::uint64_t> versions;
+
+#ifdef ECS_INSTRUMENTATION
+		// Hot-path counters behind World::stats(). Mutable because lookups
+		// also happen on const paths; views walking this storage as their
+		// base accumulate their each() timing here too. Relaxed atomics,
+		// since each_parallel probes the sparse index from pool workers and
+		// WorldView readers may overlap — the tallies only need to add up,
+		// not order anything. Not carried over by the deep copy — a
+		// detached clone starts its own tallies.
+		mutable std::atomic<std::uint64_t> inserts{0};
+		mutable std::atomic<std::uint64_t> erases{0};
+		mutable std::atomic<std::uint64_t> lookups{0};
+		mutable std::atomic<std::uint64_t> eachCalls{0};
+		mutable std::atomic<std::uint64_t> eachTimeNs{0};
+#endif
+
+		Storage() = default;
+
+		// Deep copy for copy-on-write divergence; the sparse pages are the
+		// only indirection that needs copying by hand.
+		Storage(Storage const& other)
+			: StorageBase{other}
+			, components{other.components}
+			, currentVersion{other.currentVersion}
+			, versions{other.versions}
+			, createEventDispatcher{other.createEventDispatcher}
+			, updateEventDispatcher{other.updateEventDispatcher}
+			, removeEventDispatcher{other.removeEventDispatcher}
+			, bulkUpdateEventDispatcher{other.bulkUpdateEventDispatcher}
+		{
+			sparsePages.reserve(other.sparsePages.size());
+			for (auto& page: other.sparsePages)
+			{
+				sparsePages.push_back(page
+					? std::make_unique<std::array<std::size_t, sparsePageSize>>(*page)
+					: nullptr);
+			}
+		}
+
+		std::shared_ptr<StorageBase> cloneStorage() const override
+		{
+			return std::make_shared<Storage>(*this);
+		}
+
+		bool hasPendingEvents() const override
+		{
+			return not createEventDispatcher.pending.empty()
+				|| not updateEventDispatcher.pending.empty()
+				|| not removeEventDispatcher.pending.empty();
+		}
+
+		void touch(Entity entity)
+		{
+			versions[sparseGet(entity.entityId)] = ++currentVersion;
+		}
+
+		std::size_t sparseGet(unsigned id) const
+		{
+#ifdef ECS_INSTRUMENTATION
+			lookups.fetch_add(1, std::memory_order_relaxed);
+#endif
+			auto page = id / sparsePageSize;
+			if (page >= sparsePages.size() || not sparsePages[page])
+			{
+				return missing;
+			}
+			return (*sparsePages[page])[id % sparsePageSize];
+		}
+
+		std::size_t& sparseSlot(unsigned id)
+		{
+			auto page = id / sparsePageSize;
+			if (page >= sparsePages.size())
+			{
+				sparsePages.resize(page + 1);
+			}
+			if (not sparsePages[page])
+			{
+				sparsePages[page] = std::make_unique<std::array<std::size_t, sparsePageSize>>();
+				sparsePages[page]->fill(missing);
+			}
+			return (*sparsePages[page])[id % sparsePageSize];
+		}
+
+		bool contains(Entity entity) const override
+		{
+			return sparseGet(entity.entityId) != missing;
+		}
+
+		// at() requires a present entity; the assert catches what used to be
+		// a thrown std::out_of_range when storage was map-backed.
+		Component& at(Entity entity)
+		{
+			auto index = sparseGet(entity.entityId);
+			assert(index != missing);
+			return components[index];
+		}
+
+		Component const& at(Entity entity) const
+		{
+			auto index = sparseGet(entity.entityId);
+			assert(index != missing);
+			return components[index];
+		}
+
+		Component const* find(Entity entity) const
+		{
+			auto index = sparseGet(entity.entityId);
+			return index == missing ? nullptr : &components[index];
+		}
+
+		void erase(Entity entity) override
+		{
+			auto index = sparseGet(entity.entityId);
+			if (index == missing)
+			{
+				return;
+			}
+#ifdef ECS_INSTRUMENTATION
+			erases.fetch_add(1, std::memory_order_relaxed);
+#endif
+			auto lastIndex = components.size() - 1;
+			if (index != lastIndex)
+			{
+				components[index] = std::move(components[lastIndex]);
+				entities[index] = entities[lastIndex];
+				versions[index] = versions[lastIndex];
+				sparseSlot(entities[index].entityId) = index;
+			}
+			components.pop_back();
+			entities.pop_back();
+			versions.pop_back();
+			sparseSlot(entity.entityId) = missing;
+		}
+
+		void flushEvents(World& world) override
+		{
+			createEventDispatcher.flush(world);
+			updateEventDispatcher.flush(world);
+			removeEventDispatcher.flush(world);
+		}
+
+		void erase(World& world, Entity entity) override
+		{
+			if (not contains(entity))
+			{
+				return;
+			}
+			removeEventDispatcher.publish(world, entity);
+			erase(entity);
+		}
+
+		void moveTo(World& source, Entity entity, World& target, Entity targetEntity) override
+		{
+			if (not contains(entity))
+			{
+				return;
+			}
+			removeEventDispatcher.publish(source, entity);
+			// Re-probe after the publish: a group hook may have shuffled the
+			// dense arrays under us.
+			target.assign<Component>(targetEntity, std::move(components[sparseGet(entity.entityId)]));
+			erase(entity);
+		}
+
+		std::size_t index(Entity entity) const
+		{
+			return sparseGet(entity.entityId);
+		}
+
+		// Pre-grows the dense arrays and the sparse pages covering entity
+		// ids [0, capacity), e.g. at level load.
+		void reserve(std::size_t capacity)
+		{
+			components.reserve(capacity);
+			entities.reserve(capacity);
+			versions.reserve(capacity);
+			for (std::size_t id = 0; id < capacity; id += sparsePageSize)
+			{
+				sparseSlot(static_cast<unsigned>(id));
+			}
+		}
+
+		void swapElements(std::size_t a, std::size_t b)
+		{
+			if (a == b)
+			{
+				return;
+			}
+			std::swap(components[a], components[b]);
+			std::swap(entities[a], entities[b]);
+			std::swap(versions[a], versions[b]);
+			sparseSlot(entities[a].entityId) = a;
+			sparseSlot(entities[b].entityId) = b;
+		}
+
+		// In-place permutation sort: sorts an index scratch buffer (reused
+		// across calls, so steady-state sorting does not allocate), then
+		// applies the permutation with sparse-aware element swaps.
+		template <typename Compare>
+		void sort(Compare compare)
+		{
+			auto count = components.size();
+			sortScratch.resize(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				sortScratch[i] = i;
+			}
+			std::sort(sortScratch.begin(), sortScratch.end(),
+				[this, &compare](std::size_t a, std::size_t b)
+				{
+					return compare(components[a], components[b]);
+				});
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				while (sortScratch[i] != i)
+				{
+					auto target = sortScratch[i];
+					swapElements(i, target);
+					std::swap(sortScratch[i], sortScratch[target]);
+				}
+			}
+		}
+
+		std::vector<std::size_t> sortScratch;
+
+		void insert_or_assign(Entity entity, Component component)
+		{
+#ifdef ECS_INSTRUMENTATION
+			inserts.fetch_add(1, std::memory_order_relaxed);
+#endif
+			auto& slot = sparseSlot(entity.entityId);
+			if (slot != missing)
+			{
+				components[slot] = std::move(component);
+				versions[slot] = ++currentVersion;
+				return;
+			}
+			slot = components.size();
+			components.push_back(std::move(component));
+			entities.push_back(entity);
+			versions.push_back(++currentVersion);
+		}
+
+		struct EventDispatcher
+		{
+			using Callback = Delegate<void(World&, Entity)>;
+
+			unsigned connect(Callback f)
+			{
+				auto id = nextCallbackId++;
+				callbacks.push_back({id, f});
+				return id;
+			}
+
+			// Compile-time bound observers, for systems connecting member
+			// functions: connect<&MySystem::onCreated>(&system).
+			template <auto Function, typename T>
+			unsigned connect(T* instance)
+			{
+				return connect(Callback::template bind<Function>(instance));
+			}
+
+			template <auto Function>
+			unsigned connect()
+			{
+				return connect(Callback::template bind<Function>());
+			}
+
+			void disconnect(unsigned callbackId)
+			{
+				std::erase_if(callbacks,
+					[callbackId](Entry const& entry) { return entry.id == callbackId; });
+			}
+
+			// In deferred mode publish only records the entity; the batch is
+			// dispatched by flush(), once per frame. Storages owned by a
+			// group must stay immediate — group maintenance relies on
+			// observing structural changes as they happen.
+			void setDeferred(bool deferred_)
+			{
+				deferred = deferred_;
+			}
+
+			void publish(World& world, Entity entity)
+			{
+#ifdef ECS_INSTRUMENTATION
+				++publishes;
+#endif
+				if (deferred)
+				{
+					pending.push_back(entity);
+					return;
+				}
+				dispatch(world, entity);
+			}
+
+			void flush(World& world)
+			{
+				for (auto entity: pending)
+				{
+					dispatch(world, entity);
+				}
+				pending.clear();
+			}
+
+			struct Entry
+			{
+				unsigned id;
+				Callback callback;
+			};
+
+			std::vector<Entry> callbacks;
+			std::vector<Entity> pending;
+			unsigned nextCallbackId = 0;
+			bool deferred = false;
+#ifdef ECS_INSTRUMENTATION
+			// Plain, unlike the storage counters: publishing is structural,
+			// and structural changes are forbidden on the parallel paths.
+			std::uint64_t publishes = 0;
+#endif
+
+		private:
+			void dispatch(World& world, Entity entity)
+			{
+				for (auto& entry: callbacks)
+				{
+					entry.callback(world, entity);
+				}
+			}
+		};
+
+		// Storage-level event for batch updates that touch every component.
+		struct BulkEventDispatcher
+		{
+			using Callback = Delegate<void(World&)>;
+
+			unsigned connect(Callback f)
+			{
+				auto id = nextCallbackId++;
+				callbacks.push_back({id, f});
+				return id;
+			}
+
+			template <auto Function, typename T>
+			unsigned connect(T* instance)
+			{
+				return connect(Callback::template bind<Function>(instance));
+			}
+
+			template <auto Function>
+			unsigned connect()
+			{
+				return connect(Callback::template bind<Function>());
+			}
+
+			void disconnect(unsigned callbackId)
+			{
+				std::erase_if(callbacks,
+					[callbackId](Entry const& entry) { return entry.id == callbackId; });
+			}
+
+			void publish(World& world)
+			{
+#ifdef ECS_INSTRUMENTATION
+				++publishes;
+#endif
+				for (auto& entry: callbacks)
+				{
+					entry.callback(world);
+				}
+			}
+
+			struct Entry
+			{
+				unsigned id;
+				Callback callback;
+			};
+
+			std::vector<Entry> callbacks;
+			unsigned nextCallbackId = 0;
+#ifdef ECS_INSTRUMENTATION
+			std::uint64_t publishes = 0;
+#endif
+		};
+
+		EventDispatcher createEventDispatcher;
+		EventDispatcher updateEventDispatcher;
+		EventDispatcher removeEventDispatcher;
+		BulkEventDispatcher bulkUpdateEventDispatcher;
+	};
+
+	std::vector<unsigned> generations;
+	std::vector<unsigned> freeIds;
+	// Per-entity bitset of the component families the entity has, one bit
+	// per family: multi-component filtering is a single mask test. Families
+	// beyond the word width fall back to storage probes.
+	std::vector<SignatureWord> signatures;
+	std::size_t aliveCount = 0;
+
+	template <typename Component>
+	static std::uint64_t signatureBit()
+	{
+		auto familyId = ComponentFamily::id<Component>();
+		if (familyId >= 64)
+		{
+			return 0;
+		}
+		return std::uint64_t{1} << familyId;
+	}
+
+	std::uint64_t signatureOf(Entity entity) const
+	{
+		return entity.entityId < signatures.size() ? signatures[entity.entityId].load() : 0;
+	}
+	std::vector<std::shared_ptr<StorageBase>> componentStorage;
+	std::unordered_map<std::type_index, std::size_t> groupSizes;
+	// Guards the entity table and the storage table itself; the storages'
+	// contents are guarded by their own per-storage mutexes.
+	mutable CopyableSharedMutex entityMutex;
+
+	// Resolves the mutexes of the named storages, sorted by family id so
+	// every guard locks them in the same order. Missing storages are
+	// skipped — there is nothing to protect yet.
+	template <typename... Components>
+	std::vector<std::shared_mutex*> storageMutexes() const
+	{
+		std::shared_lock tableLock{entityMutex};
+		std::vector<std::pair<unsigned, std::shared_mutex*>> found;
+		found.reserve(sizeof...(Components));
+		(collectStorageMutex<Components>(found), ...);
+		std::sort(found.begin(), found.end());
+		std::vector<std::shared_mutex*> mutexes;
+		mutexes.reserve(found.size());
+		for (auto& [familyId, mutex]: found)
+		{
+			mutexes.push_back(mutex);
+		}
+		return mutexes;
+	}
+
+	template <typename Component>
+	void collectStorageMutex(std::vector<std::pair<unsigned, std::shared_mutex*>>& found) const
+	{
+		auto familyId = ComponentFamily::id<Component>();
+		if (familyId < componentStorage.size() && componentStorage[familyId])
+		{
+			found.emplace_back(familyId, &componentStorage[familyId]->storageMutex);
+		}
+	}
+
+	// Copy-on-write support: clones share whole storages until one side
+	// mutates, at which point the mutable access path detaches its copy.
+	StorageBase& mutableStorage(std::size_t familyId)
+	{
+		assert(familyId < componentStorage.size() && componentStorage[familyId]);
+		auto& slot = componentStorage[familyId];
+		if (slot.use_count() > 1)
+		{
+			slot = slot->cloneStorage();
+		}
+		return *slot;
+	}
+
+	template <typename... Components>
+	void groupTryAdd(Entity entity)
+	{
+		auto& size = groupSizes.at(typeid(Group<Components...>));
+		if (not (getStorage<Components>().contains(entity) && ...))
+		{
+			return;
+		}
+		using First = std::tuple_element_t<0, std::tuple<Components...>>;
+		if (getStorage<First>().index(entity) < size)
+		{
+			return;
+		}
+		(getStorage<Components>().swapElements(getStorage<Components>().index(entity), size), ...);
+		++size;
+	}
+
+	template <typename... Components>
+	void groupTryRemove(Entity entity)
+	{
+		auto& size = groupSizes.at(typeid(Group<Components...>));
+		if (not (getStorage<Components>().contains(entity) && ...))
+		{
+			return;
+		}
+		using First = std::tuple_element_t<0, std::tuple<Components...>>;
+		if (getStorage<First>().index(entity) >= size)
+		{
+			return;
+		}
+		--size;
+		(getStorage<Components>().swapElements(getStorage<Components>().index(entity), size), ...);
+	}
+
+	template <typename Component>
+	void ensureStorage()
+	{
+		auto familyId = ComponentFamily::id<Component>();
+		if (familyId >= componentStorage.size())
+		{
+			componentStorage.resize(familyId + 1);
+		}
+		if (not componentStorage[familyId])
+		{
+			componentStorage[familyId] = std::make_shared<Storage<Component>>();
+		}
+	}
 
-			Iterator& operator++()
+	template <typename Component>
+	auto& getStorage()
+	{
+		return static_cast<Storage<Component>&>(mutableStorage(ComponentFamily::id<Component>()));
+	}
+
+	// Both flavors require the storage to exist (see get's precondition);
+	// every path that tolerates a missing storage checks hasStorage first.
+	template <typename Component>
+	auto const& getStorage() const
+	{
+		assert(hasStorage<Component>());
+		return *static_cast<Storage<Component>*>(componentStorage[ComponentFamily::id<Component>()].get());
+	}
+
+	template <typename Component>
+	bool hasStorage() const
+	{
+		auto familyId = ComponentFamily::id<Component>();
+		return familyId < componentStorage.size() && componentStorage[familyId] != nullptr;
+	}
+
+	template <typename Component>
+	Storage<Component> const* storagePointer() const
+	{
+		if (not hasStorage<Component>())
+		{
+			return nullptr;
+		}
+		return &getStorage<Component>();
+	}
+
+	template <typename...>
+	class View;
+
+	template <typename... Excluded, typename... Components>
+	class View<Exclude<Excluded...>, Components...>: public std::ranges::view_base
+	{
+		// A single-component view without exclusions walks its own storage,
+		// so every slot matches: iteration is random access and sized.
+		static constexpr bool isDense = sizeof...(Components) == 1 && sizeof...(Excluded) == 0;
+
+	public:
+		View(World const* world_, Storage<Components> const*... storages_)
+			: world{world_}
+			, storages{storages_...}
+			, requiredMask{(signatureBit<Components>() | ... | 0)}
+			, excludedMask{(signatureBit<Excluded>() | ... | 0)}
+		{}
+
+		template <typename Callable>
+		void each(Callable f) const
+		{
+			if (not allStoragesExist())
+			{
+				return;
+			}
+#ifdef ECS_INSTRUMENTATION
+			auto start = std::chrono::steady_clock::now();
+#endif
+			// Walking the base storage back to front keeps iteration valid
+			// when the callback removes the current entity's components:
+			// the swap-and-pop erase only disturbs already visited slots.
+			auto& baseEntities = base()->entities;
+			for (auto index = baseEntities.size(); index-- > 0;)
+			{
+				auto entity = baseEntities[index];
+				if (matches(entity))
+				{
+					f(entity, getStorage<Components>().at(entity)...);
+				}
+			}
+#ifdef ECS_INSTRUMENTATION
+			auto* baseStorage = std::get<0>(storages);
+			baseStorage->eachCalls.fetch_add(1, std::memory_order_relaxed);
+			baseStorage->eachTimeNs.fetch_add(static_cast<std::uint64_t>(
+				std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - start).count()),
+				std::memory_order_relaxed);
+#endif
+		}
+
+		// Runs f over the matched entities on the shared worker pool. The
+		// callback must not make structural changes to the world; disjoint
+		// component writes through the world are the caller's responsibility
+		// to keep race-free.
+		template <typename Callable>
+		void each_parallel(Callable f, std::size_t chunkSize = 1024) const
+		{
+			if (not allStoragesExist())
 			{
-				while (entityIterator != endIterator)
+				return;
+			}
+			auto& baseEntities = base()->entities;
+			ThreadPool::shared().parallelFor(baseEntities.size(), chunkSize,
+				[&](std::size_t begin, std::size_t end)
 				{
-					++entityIterator;
-					auto entity = *entityIterator;
-					if ((container->getStorage<Components>().contains(entity) && ...))
+					for (auto index = begin; index < end; ++index)
 					{
-						break;
+						auto entity = baseEntities[index];
+						if (matches(entity))
+						{
+							f(entity, getStorage<Components>().at(entity)...);
+						}
 					}
+				});
+		}
+
+		// Hands f whole contiguous slices of the packed arrays —
+		// (span<Entity const>, span<Component const>) — instead of one
+		// entity at a time, so trivial kernels keep vectorizing across the
+		// callback boundary. Only dense views have contiguous matches; for
+		// multi-component kernels put the components in a group and use
+		// Group::each_chunk, which slices the co-sorted prefix. The callback
+		// must not make structural changes — the spans alias live storage.
+		template <typename Callable>
+		void each_chunk(Callable f, std::size_t chunkSize = 4096) const
+			requires isDense && (not (std::is_empty_v<Components> || ...))
+		{
+			if (not allStoragesExist())
+			{
+				return;
+			}
+			auto* storage = std::get<0>(storages);
+			auto count = storage->entities.size();
+			for (std::size_t begin = 0; begin < count; begin += chunkSize)
+			{
+				auto length = std::min(chunkSize, count - begin);
+				f(std::span<Entity const>{storage->entities.data() + begin, length},
+					std::span<Components const>{storage->components.data() + begin, length}...);
+			}
+		}
+
+		class Iterator
+		{
+		public:
+			using value_type = std::tuple<Entity, Components const&...>;
+			using reference = value_type;
+			using pointer = void;
+			using difference_type = std::ptrdiff_t;
+			using iterator_category = std::forward_iterator_tag;
+			using iterator_concept = std::conditional_t<isDense,
+				std::random_access_iterator_tag, std::forward_iterator_tag>;
+
+			Iterator() = default;
+
+			Iterator(View const* container_, std::size_t index_)
+				: container{container_}
+				, index{index_}
+			{}
+
+			reference operator*() const
+			{
+				if constexpr (isDense)
+				{
+					return {container->base()->entities[index],
+						std::get<Storage<Components> const*>(container->storages)->components[index]...};
+				}
+				else
+				{
+					auto entity = container->base()->entities[index];
+					return {entity, container->getStorage<Components>().at(entity)...};
+				}
+			}
+
+			Iterator& operator++()
+			{
+				++index;
+				if constexpr (not isDense)
+				{
+					index = container->nextMatch(index);
 				}
 				return *this;
 			}
 
+			Iterator operator++(int)
+			{
+				auto copy = *this;
+				++*this;
+				return copy;
+			}
+
+			friend bool operator==(Iterator const& a, Iterator const& b)
+			{
+				return a.index == b.index;
+			}
+
+			friend std::strong_ordering operator<=>(Iterator const& a, Iterator const& b)
+				requires isDense
+			{
+				return a.index <=> b.index;
+			}
+
+			Iterator& operator--() requires isDense
+			{
+				--index;
+				return *this;
+			}
+
+			Iterator operator--(int) requires isDense
+			{
+				auto copy = *this;
+				--index;
+				return copy;
+			}
+
+			Iterator& operator+=(difference_type n) requires isDense
+			{
+				index = static_cast<std::size_t>(static_cast<difference_type>(index) + n);
+				return *this;
+			}
+
+			Iterator& operator-=(difference_type n) requires isDense
+			{
+				return *this += -n;
+			}
+
+			friend Iterator operator+(Iterator it, difference_type n) requires isDense
+			{
+				it += n;
+				return it;
+			}
+
+			friend Iterator operator+(difference_type n, Iterator it) requires isDense
+			{
+				it += n;
+				return it;
+			}
+
+			friend Iterator operator-(Iterator it, difference_type n) requires isDense
+			{
+				it -= n;
+				return it;
+			}
+
+			friend difference_type operator-(Iterator const& a, Iterator const& b) requires isDense
+			{
+				return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+			}
+
+			reference operator[](difference_type n) const requires isDense
+			{
+				return *(*this + n);
+			}
+
 		private:
-			View<Components...>* container;
-			std::set<Entity>::iterator entityIterator;
-			std::set<Entity>::iterator endIterator;
+			View const* container = nullptr;
+			std::size_t index = 0;
 		};
 
-		Iterator begin()
+		Iterator begin() const
+		{
+			return {this, nextMatch(0)};
+		}
+
+		Iterator end() const
 		{
-			auto& base = storages.begin()->second;
-			return {this, base->entities.begin(), base->entities.end()};
+			return {this, baseSize()};
 		}
 
-		Iterator end()
+		std::size_t size() const requires isDense
 		{
-			auto& base = storages.begin()->second;
-			return {this, base->entities.end(), base->entities.end()};
+			return baseSize();
 		}
 
 	private:
-		std::unordered_map<std::type_index, std::unique_ptr<StorageBase>> storages;
+		World const* world;
+		std::tuple<Storage<Components> const*...> storages;
+		std::uint64_t requiredMask;
+		std::uint64_t excludedMask;
+
+		StorageBase const* base() const
+		{
+			return std::get<0>(storages);
+		}
+
+		bool allStoragesExist() const
+		{
+			return ((std::get<Storage<Components> const*>(storages) != nullptr) && ...);
+		}
+
+		std::size_t baseSize() const
+		{
+			if (not allStoragesExist())
+			{
+				return 0;
+			}
+			return base()->entities.size();
+		}
+
+		bool matches(Entity entity) const
+		{
+			// One word AND covers every tracked family; storage probes only
+			// remain for families past the signature width.
+			auto signature = world->signatureOf(entity);
+			return (signature & requiredMask) == requiredMask
+				&& (signature & excludedMask) == 0
+				&& ((signatureBit<Components>() != 0
+					|| getStorage<Components>().contains(entity)) && ...)
+				&& ((signatureBit<Excluded>() != 0
+					|| not world->has<Excluded>(entity)) && ...);
+		}
+
+		std::size_t nextMatch(std::size_t index) const
+		{
+			if constexpr (isDense)
+			{
+				return std::min(index, baseSize());
+			}
+			else
+			{
+				auto size = baseSize();
+				while (index < size && not matches(base()->entities[index]))
+				{
+					++index;
+				}
+				return index;
+			}
+		}
 
 		template <typename Component>
-		auto const& getStorage()
+		auto const& getStorage() const
+		{
+			return *std::get<Storage<std::remove_const_t<Component>> const*>(storages);
+		}
+	};
+
+	template <typename Component>
+	class ModifiedView
+	{
+	public:
+		ModifiedView(Storage<Component> const* storage_, std::uint64_t since_)
+			: storage{storage_}
+			, since{since_}
+		{}
+
+		template <typename Callable>
+		void each(Callable f) const
+		{
+			if (storage == nullptr)
+			{
+				return;
+			}
+			for (auto index = storage->entities.size(); index-- > 0;)
+			{
+				if (storage->versions[index] > since)
+				{
+					f(storage->entities[index], storage->components[index]);
+				}
+			}
+		}
+
+	private:
+		Storage<Component> const* storage;
+		std::uint64_t since;
+	};
+
+	template <typename... Components>
+	class Group
+	{
+	public:
+		Group(std::size_t const* size_, Storage<Components>*... storages_)
+			: groupSize{size_}
+			, storages{storages_...}
+		{}
+
+		std::size_t size() const
+		{
+			return *groupSize;
+		}
+
+		template <typename Callable>
+		void each(Callable f) const
+		{
+			auto& baseEntities = std::get<0>(storages)->entities;
+			for (auto index = *groupSize; index-- > 0;)
+			{
+				f(baseEntities[index], std::get<Storage<Components>*>(storages)->components[index]...);
+			}
+		}
+
+		// Parallel walk over the packed group prefix; same restrictions as
+		// View::each_parallel.
+		template <typename Callable>
+		void each_parallel(Callable f, std::size_t chunkSize = 1024) const
+		{
+			auto& baseEntities = std::get<0>(storages)->entities;
+			ThreadPool::shared().parallelFor(*groupSize, chunkSize,
+				[&](std::size_t begin, std::size_t end)
+				{
+					for (auto index = begin; index < end; ++index)
+					{
+						f(baseEntities[index], std::get<Storage<Components>*>(storages)->components[index]...);
+					}
+				});
+		}
+
+		// Chunked batch access to the group prefix: f receives the entity
+		// slice and one mutable component slice per member storage, aligned
+		// index for index because the group keeps its storages co-sorted.
+		// Same restriction as the view flavor — no structural changes.
+		template <typename Callable>
+		void each_chunk(Callable f, std::size_t chunkSize = 4096) const
+			requires (not (std::is_empty_v<Components> || ...))
 		{
-			return *static_cast<Storage<Component>*>(storages[typeid(std::remove_const_t<Component>)].get());
+			auto count = *groupSize;
+			for (std::size_t begin = 0; begin < count; begin += chunkSize)
+			{
+				auto length = std::min(chunkSize, count - begin);
+				f(std::span<Entity const>{std::get<0>(storages)->entities.data() + begin, length},
+					std::span<Components>{std::get<Storage<Components>*>(storages)->components.data() + begin, length}...);
+			}
 		}
+
+	private:
+		std::size_t const* groupSize;
+		std::tuple<Storage<Components>*...> storages;
 	};
 };
+
+// A read-only handle onto a World for worker threads. Any number of
+// WorldViews can read concurrently with each other and with writers that
+// follow the locking discipline described on World. The per-entity accessors
+// take their own shared locks and return copies, so the results stay valid
+// after the lock is gone; view() iteration touches live storage pointers and
+// must happen under a readAccess() guard held for the whole traversal.
+class WorldView
+{
+public:
+	explicit WorldView(World const& world_)
+		: world{&world_}
+	{}
+
+	bool isAlive(Entity entity) const
+	{
+		auto lock = world->readAccess();
+		return world->isAlive(entity);
+	}
+
+	std::size_t size() const
+	{
+		auto lock = world->readAccess();
+		return world->size();
+	}
+
+	template <typename Component>
+	Component get(Entity entity) const
+	{
+		auto lock = world->readAccess<Component>();
+		return world->get<Component>(entity);
+	}
+
+	template <typename Component>
+	std::optional<Component> try_get(Entity entity) const
+	{
+		auto lock = world->readAccess<Component>();
+		if (auto* component = world->try_get<Component>(entity))
+		{
+			return *component;
+		}
+		return std::nullopt;
+	}
+
+	template <typename Component>
+	bool has(Entity entity) const
+	{
+		auto lock = world->readAccess<Component>();
+		return world->has<Component>(entity);
+	}
+
+	template <typename... Components>
+	auto readAccess() const
+	{
+		return world->readAccess<Components...>();
+	}
+
+	template <typename... Components, typename... Excluded>
+	auto view(Exclude<Excluded...> excluded = {}) const
+	{
+		return world->view<Components...>(excluded);
+	}
+
+private:
+	World const* world;
+};
+
+// Records structural changes into a flat buffer so they can be made safely
+// from inside View::each and played back in one batch once iteration is done.
+class CommandBuffer
+{
+public:
+	template <typename Component, typename... Ts>
+	void assign(Entity entity, Ts&&... args)
+	{
+		commands.push_back([entity, ...capturedArgs = std::forward<Ts>(args)](World& world)
+		{
+			world.assign<Component>(entity, capturedArgs...);
+		});
+	}
+
+	template <typename Component>
+	void remove(Entity entity)
+	{
+		commands.push_back([entity](World& world)
+		{
+			world.remove<Component>(entity);
+		});
+	}
+
+	void destroyEntity(Entity entity)
+	{
+		commands.push_back([entity](World& world)
+		{
+			world.destroyEntity(entity);
+		});
+	}
+
+	// The entity only exists at playback time, so setup receives it then:
+	// buffer.createEntity([](World& world, Entity entity) { ... });
+	template <typename Callable>
+	void createEntity(Callable setup)
+	{
+		commands.push_back([setup](World& world)
+		{
+			setup(world, world.createEntity());
+		});
+	}
+
+	std::size_t size() const
+	{
+		return commands.size();
+	}
+
+	void playback(World& world)
+	{
+		for (auto& command: commands)
+		{
+			command(world);
+		}
+		commands.clear();
+	}
+
+private:
+	std::vector<std::function<void(World&)>> commands;
+};
@@ -0,0 +1,92 @@
+#include "catch.hpp"
+
+#include "ecs/world.h"
+
+namespace
+{
+
+World makeJoinWorld(std::size_t count)
+{
+	World world;
+	auto batch = world.createEntities(count);
+	world.assign<int>(batch, [](Entity entity) { return static_cast<int>(entity.entityId); });
+	std::vector<Entity> evens;
+	evens.reserve(count / 2);
+	for (std::size_t i = 0; i < batch.size(); i += 2)
+	{
+		evens.push_back(batch[i]);
+	}
+	world.assign<float>(evens, 1.f);
+	return world;
+}
+
+} // namespace
+
+TEST_CASE("entity churn", "[benchmark]")
+{
+	World world;
+	BENCHMARK("createEntity + destroyEntity")
+	{
+		auto entity = world.createEntity();
+		world.destroyEntity(entity);
+		return entity.entityId;
+	};
+}
+
+TEST_CASE("assign", "[benchmark]")
+{
+	World world;
+	auto entity = world.createEntity();
+
+	BENCHMARK("assign without observers")
+	{
+		world.assign<int>(entity, 1);
+		return world.get<int>(entity);
+	};
+
+	world.onCreate<int>().connect([](World&, Entity) {});
+	world.onUpdate<int>().connect([](World&, Entity) {});
+
+	BENCHMARK("assign with connected observers")
+	{
+		world.assign<int>(entity, 1);
+		return world.get<int>(entity);
+	};
+}
+
+TEST_CASE("single-component get", "[benchmark]")
+{
+	auto world = makeJoinWorld(100'000);
+	auto probe = Entity{50'000};
+
+	BENCHMARK("get<int>")
+	{
+		return world.get<int>(probe);
+	};
+}
+
+TEST_CASE("view each joins", "[benchmark]")
+{
+	auto benchJoins = [](std::size_t count)
+	{
+		auto world = makeJoinWorld(count);
+
+		BENCHMARK("each<int> over " + std::to_string(count))
+		{
+			long sum = 0;
+			world.view<int>().each([&sum](Entity, int n) { sum += n; });
+			return sum;
+		};
+
+		BENCHMARK("each<int, float> over " + std::to_string(count))
+		{
+			long sum = 0;
+			world.view<int, float>().each([&sum](Entity, int n, float) { sum += n; });
+			return sum;
+		};
+	};
+
+	SECTION("1k") { benchJoins(1'000); }
+	SECTION("100k") { benchJoins(100'000); }
+	SECTION("1M") { benchJoins(1'000'000); }
+}
@@ -1,5 +1,16 @@
 #include "catch.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <thread>
+
+#include "ecs/snapshot.h"
+#include "ecs/static_world.h"
 #include "ecs/world.h"
 
 TEST_CASE("World :: component storage", "[ECS]")
@@ -131,6 +142,33 @@ TEST_CASE("views", "[ECS]")
 		CHECK(reached);
 	}
 
+	SECTION("exclusion filters")
+	{
+		world.assign<int>(entity, 0);
+		auto frozen = world.createEntity();
+		world.assign<int>(frozen, 1);
+		world.assign<float>(frozen, 0.f);
+
+		bool reached = false;
+		world.view<int>(exclude<float>).each(
+			[&](Entity e, int n)
+			{
+				reached = true;
+				CHECK(e == entity);
+				CHECK(n == 0);
+			}
+		);
+		CHECK(reached);
+
+		int count = 0;
+		for (auto&& [e, n]: world.view<int>(exclude<float>))
+		{
+			++count;
+			CHECK(e == entity);
+		}
+		CHECK(count == 1);
+	}
+
 	SECTION("joint view only shows entities that have both components")
 	{
 		world.assign<int>(entity, 0);
@@ -171,6 +209,357 @@ TEST_CASE("views", "[ECS]")
 	}
 }
 
+TEST_CASE("entity recycling", "[ECS]")
+{
+	World world;
+	auto entity = world.createEntity();
+
+	SECTION("a created entity is alive")
+	{
+		CHECK(world.isAlive(entity));
+	}
+
+	SECTION("a destroyed entity is no longer alive")
+	{
+		world.destroyEntity(entity);
+		CHECK_FALSE(world.isAlive(entity));
+		CHECK(world.size() == 0ull);
+	}
+
+	SECTION("destroyed slots are reused with a bumped generation")
+	{
+		world.destroyEntity(entity);
+		auto recycled = world.createEntity();
+		CHECK(recycled.entityId == entity.entityId);
+		CHECK(recycled.generation == entity.generation + 1);
+		CHECK(world.isAlive(recycled));
+		CHECK_FALSE(world.isAlive(entity));
+	}
+
+	SECTION("stale handles see no components")
+	{
+		world.assign<int>(entity, 0);
+		world.destroyEntity(entity);
+		auto recycled = world.createEntity();
+		world.assign<int>(recycled, 1);
+		CHECK_FALSE(world.has<int>(entity));
+		CHECK(world.has<int>(recycled));
+	}
+
+	SECTION("mutation through a stale handle is ignored")
+	{
+		world.assign<int>(entity, 0);
+		world.destroyEntity(entity);
+		auto recycled = world.createEntity();
+		world.assign<int>(recycled, 1);
+
+		world.assign<int>(entity, 9);
+		world.transform<int>(entity, [](int n) { return n + 9; });
+		world.patch<int>(entity, [](int& n) { n += 9; });
+		world.remove<int>(entity);
+
+		CHECK(world.get<int>(recycled) == 1);
+		CHECK(world.has<int>(recycled));
+	}
+
+	SECTION("a handle from another world's larger table is ignored")
+	{
+		World other;
+		Entity foreign{};
+		for (int n = 0; n < 10; ++n)
+		{
+			foreign = other.createEntity();
+		}
+		world.assign<int>(foreign, 1);
+		std::vector<Entity> batch{foreign};
+		world.assign<int>(std::span<Entity const>{batch}, 2);
+		CHECK(world.size() == 1ull);
+		CHECK_FALSE(world.has<int>(foreign));
+	}
+}
+
+TEST_CASE("groups", "[ECS]")
+{
+	World world;
+	auto entity = world.createEntity();
+	world.assign<int>(entity, 0);
+	world.assign<float>(entity, 0.f);
+	auto intOnly = world.createEntity();
+	world.assign<int>(intOnly, 1);
+
+	auto group = world.group<int, float>();
+
+	SECTION("only fully matching entities are grouped")
+	{
+		CHECK(group.size() == 1ull);
+		bool reached = false;
+		group.each(
+			[&](Entity e, int n, float f)
+			{
+				reached = true;
+				CHECK(e == entity);
+				CHECK(n == 0);
+				CHECK(f == 0.f);
+			}
+		);
+		CHECK(reached);
+	}
+
+	SECTION("entities join the group as they gain components")
+	{
+		world.assign<float>(intOnly, 1.f);
+		CHECK(group.size() == 2ull);
+	}
+
+	SECTION("entities leave the group as they lose components")
+	{
+		world.remove<float>(entity);
+		CHECK(group.size() == 0ull);
+	}
+
+	SECTION("destroyed entities leave the group")
+	{
+		world.destroyEntity(entity);
+		CHECK(group.size() == 0ull);
+	}
+
+	SECTION("group members can be mutated through each")
+	{
+		group.each([](Entity, int& n, float&) { n = 7; });
+		CHECK(world.get<int>(entity) == 7);
+	}
+}
+
+TEST_CASE("snapshots", "[ECS]")
+{
+	auto path = (std::filesystem::temp_directory_path() / "ecs_snapshot_test.bin").string();
+
+	Snapshot snapshot;
+	snapshot.registerComponent<int>(1);
+	snapshot.registerComponent<float>(2);
+
+	World world;
+	auto entity = world.createEntity();
+	world.assign<int>(entity, 42);
+	world.assign<float>(entity, 3.f);
+	auto doomed = world.createEntity();
+	world.destroyEntity(doomed);
+
+	snapshot.save(world, path);
+
+	World restored;
+	snapshot.load(restored, path);
+
+	SECTION("entity table round-trips")
+	{
+		CHECK(restored.size() == world.size());
+		CHECK(restored.isAlive(entity));
+		CHECK_FALSE(restored.isAlive(doomed));
+	}
+
+	SECTION("components round-trip")
+	{
+		REQUIRE(restored.has<int>(entity));
+		CHECK(restored.get<int>(entity) == 42);
+		CHECK(restored.get<float>(entity) == 3.f);
+	}
+
+	SECTION("the restored world recycles ids like the original would")
+	{
+		auto recycled = restored.createEntity();
+		CHECK(recycled.entityId == doomed.entityId);
+		CHECK(recycled.generation == doomed.generation + 1);
+	}
+
+	SECTION("a stored entity id outside the entity table is rejected")
+	{
+		// Byte 64 starts the int storage's first entity id (magic, version,
+		// entity table, entry count, tag, size and count precede it).
+		std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+		file.seekp(64);
+		std::uint32_t hostileId = 0xffffffff;
+		file.write(reinterpret_cast<char const*>(&hostileId), sizeof(hostileId));
+		file.close();
+
+		World victim;
+		CHECK_THROWS_WITH(snapshot.load(victim, path),
+			"Snapshot: entity id out of range");
+	}
+
+	SECTION("a count larger than the file is rejected without overflowing")
+	{
+		// Byte 56 holds the int storage's element count.
+		std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+		file.seekp(56);
+		std::uint64_t hostileCount = 0xffff'ffff'ffff'ffff;
+		file.write(reinterpret_cast<char const*>(&hostileCount), sizeof(hostileCount));
+		file.close();
+
+		World victim;
+		CHECK_THROWS_WITH(snapshot.load(victim, path), "Snapshot: truncated file");
+	}
+
+	std::remove(path.c_str());
+}
+
+TEST_CASE("bulk creation and assignment", "[ECS]")
+{
+	World world;
+
+	SECTION("createEntities returns a contiguous id range")
+	{
+		auto batch = world.createEntities(100);
+		REQUIRE(batch.size() == 100ull);
+		CHECK(world.size() == 100ull);
+		for (std::size_t i = 0; i < batch.size(); ++i)
+		{
+			CHECK(batch[i].entityId == batch[0].entityId + i);
+			CHECK(world.isAlive(batch[i]));
+		}
+	}
+
+	SECTION("bulk assign with a prototype value")
+	{
+		auto batch = world.createEntities(10);
+		world.assign<int>(batch, 7);
+		for (auto entity: batch)
+		{
+			CHECK(world.get<int>(entity) == 7);
+		}
+	}
+
+	SECTION("bulk assign with a generator")
+	{
+		auto batch = world.createEntities(10);
+		world.assign<int>(batch, [](Entity e) { return static_cast<int>(e.entityId); });
+		CHECK(world.get<int>(batch[5]) == static_cast<int>(batch[5].entityId));
+	}
+
+	SECTION("bulk assign publishes creation events")
+	{
+		int calls = 0;
+		world.onCreate<int>().connect([&calls](auto&, auto){ ++calls; });
+		auto batch = world.createEntities(10);
+		world.assign<int>(batch, 0);
+		CHECK(calls == 10);
+	}
+}
+
+TEST_CASE("command buffer", "[ECS]")
+{
+	World world;
+	auto entity = world.createEntity();
+	world.assign<int>(entity, 0);
+
+	CommandBuffer buffer;
+
+	SECTION("recorded commands only apply on playback")
+	{
+		buffer.assign<float>(entity, 1.f);
+		buffer.remove<int>(entity);
+		CHECK_FALSE(world.has<float>(entity));
+		CHECK(world.has<int>(entity));
+
+		buffer.playback(world);
+		CHECK(world.get<float>(entity) == 1.f);
+		CHECK_FALSE(world.has<int>(entity));
+		CHECK(buffer.size() == 0ull);
+	}
+
+	SECTION("structural changes recorded during iteration")
+	{
+		auto another = world.createEntity();
+		world.assign<int>(another, 1);
+
+		world.view<int>().each(
+			[&buffer](Entity e, int n)
+			{
+				if (n == 0)
+				{
+					buffer.destroyEntity(e);
+				}
+				buffer.createEntity(
+					[](World& w, Entity spawned) { w.assign<float>(spawned, 2.f); }
+				);
+			}
+		);
+		buffer.playback(world);
+
+		CHECK_FALSE(world.isAlive(entity));
+		CHECK(world.size() == 3ull);
+
+		int spawnCount = 0;
+		world.view<float>().each([&spawnCount](Entity, float f)
+		{
+			++spawnCount;
+			CHECK(f == 2.f);
+		});
+		CHECK(spawnCount == 2);
+	}
+}
+
+TEST_CASE("parallel each", "[ECS]")
+{
+	World world;
+	constexpr int entityCount = 10'000;
+	for (int i = 0; i < entityCount; ++i)
+	{
+		auto entity = world.createEntity();
+		world.assign<int>(entity, 1);
+		if (i % 2 == 0)
+		{
+			world.assign<float>(entity, 1.f);
+		}
+	}
+
+	SECTION("visits every matched entity exactly once")
+	{
+		std::atomic<int> sum = 0;
+		world.view<int>().each_parallel(
+			[&sum](Entity, int n) { sum += n; },
+			64
+		);
+		CHECK(sum == entityCount);
+	}
+
+	SECTION("joint views only visit full matches")
+	{
+		std::atomic<int> count = 0;
+		world.view<int, float>().each_parallel(
+			[&count](Entity, int, float) { ++count; },
+			64
+		);
+		CHECK(count == entityCount / 2);
+	}
+
+	SECTION("groups can mutate their components in parallel")
+	{
+		auto group = world.group<int, float>();
+		group.each_parallel([](Entity, int& n, float&) { n = 2; }, 64);
+		std::atomic<int> sum = 0;
+		group.each([&sum](Entity, int& n, float&) { sum += n; });
+		CHECK(sum == entityCount);
+	}
+
+	SECTION("nested parallel loops complete")
+	{
+		std::atomic<int> visits = 0;
+		ThreadPool::shared().parallelFor(8, 1,
+			[&visits](std::size_t outerBegin, std::size_t outerEnd)
+			{
+				for (auto outer = outerBegin; outer < outerEnd; ++outer)
+				{
+					ThreadPool::shared().parallelFor(64, 4,
+						[&visits](std::size_t begin, std::size_t end)
+						{
+							visits += static_cast<int>(end - begin);
+						});
+				}
+			});
+		CHECK(visits == 8 * 64);
+	}
+}
+
 TEST_CASE("const world", "[ECS]")
 {
 	World world;
@@ -219,6 +608,678 @@ TEST_CASE("systems", "[ECS]")
 	}
 }
 
+namespace
+{
+
+struct alignas(32) WideLane
+{
+	float values[8];
+};
+
+struct ObserverSystem
+{
+	int created = 0;
+	int removed = 0;
+
+	void onCreated(World&, Entity) { ++created; }
+	void onRemoved(World&, Entity) { ++removed; }
+};
+
+int freeObserverCalls = 0;
+
+void freeObserver(World&, Entity)
+{
+	++freeObserverCalls;
+}
+
+} // namespace
+
+TEST_CASE("cross-world migration", "[ECS]")
+{
+	World zoneA;
+	World zoneB;
+
+	SECTION("an entity carries all its components across")
+	{
+		auto entity = zoneA.createEntity();
+		zoneA.assign<int>(entity, 7);
+		zoneA.assign<float>(entity, 0.5f);
+
+		auto moved = zoneA.migrate(entity, zoneB);
+
+		CHECK(not zoneA.isAlive(entity));
+		CHECK(zoneA.size() == 0ull);
+		CHECK(zoneB.isAlive(moved));
+		CHECK(zoneB.get<int>(moved) == 7);
+		CHECK(zoneB.get<float>(moved) == 0.5f);
+	}
+
+	SECTION("migration fires remove events here and create events there")
+	{
+		auto entity = zoneA.createEntity();
+		zoneA.assign<int>(entity, 1);
+		int removals = 0;
+		int creations = 0;
+		zoneA.onRemove<int>().connect([&removals](World&, Entity) { ++removals; });
+		zoneB.onCreate<int>().connect([&creations](World&, Entity) { ++creations; });
+
+		zoneA.migrate(entity, zoneB);
+
+		CHECK(removals == 1);
+		CHECK(creations == 1);
+	}
+
+	SECTION("a dead handle migrates as a no-op")
+	{
+		auto entity = zoneA.createEntity();
+		zoneA.destroyEntity(entity);
+		CHECK(zoneA.migrate(entity, zoneB) == entity);
+		CHECK(zoneB.size() == 0ull);
+	}
+
+	SECTION("batched migration rebalances a region in one pass")
+	{
+		auto entities = zoneA.createEntities(100);
+		zoneA.assign<int>(entities, [](Entity entity) { return static_cast<int>(entity.entityId); });
+		zoneA.destroyEntity(entities[50]);
+
+		std::vector<Entity> region{entities.begin() + 25, entities.begin() + 75};
+		auto moved = zoneA.migrate(region, zoneB);
+
+		CHECK(moved.size() == 49ull); // the dead handle is skipped
+		CHECK(zoneA.size() == 50ull);
+		CHECK(zoneB.size() == 49ull);
+		CHECK(zoneB.get<int>(moved.front()) == 25);
+		CHECK(zoneB.get<int>(moved.back()) == 74);
+		CHECK(zoneA.get<int>(entities[10]) == 10);
+	}
+}
+
+TEST_CASE("tag components", "[ECS]")
+{
+	struct Frozen {};
+
+	World world;
+	auto entities = world.createEntities(10);
+	world.assign<int>(entities, [](Entity entity) { return static_cast<int>(entity.entityId); });
+	for (std::size_t i = 0; i < entities.size(); i += 2)
+	{
+		world.assign<Frozen>(entities[i]);
+	}
+
+	SECTION("tags behave like any other component")
+	{
+		CHECK(world.has<Frozen>(entities[0]));
+		CHECK(not world.has<Frozen>(entities[1]));
+		world.remove<Frozen>(entities[0]);
+		CHECK(not world.has<Frozen>(entities[0]));
+	}
+
+	SECTION("tag-filtered views match on presence")
+	{
+		int frozen = 0;
+		world.view<int, Frozen>().each([&frozen](Entity, int, Frozen) { ++frozen; });
+		CHECK(frozen == 5);
+
+		int thawed = 0;
+		world.view<int>(exclude<Frozen>).each([&thawed](Entity, int) { ++thawed; });
+		CHECK(thawed == 5);
+	}
+
+	SECTION("tags occupy no per-entity component storage")
+	{
+		struct Fat
+		{
+			char padding[64];
+		};
+
+		// Same reservation and population either way; the only difference
+		// left in bytesUsed is the dense component array the tag elides.
+		World tagged;
+		tagged.reserve<Frozen>(16);
+		World fat;
+		fat.reserve<Fat>(16);
+		for (int n = 0; n < 5; ++n)
+		{
+			tagged.assign<Frozen>(tagged.createEntity());
+			fat.assign<Fat>(fat.createEntity());
+		}
+		CHECK(tagged.stats<Frozen>().entityCount == 5ull);
+		CHECK(fat.stats<Fat>().bytesUsed
+			== tagged.stats<Frozen>().bytesUsed + 16 * sizeof(Fat));
+	}
+
+	SECTION("tags round-trip through snapshots by presence alone")
+	{
+		Snapshot snapshot;
+		snapshot.registerComponent<int>(1);
+		snapshot.registerComponent<Frozen>(2);
+		auto path = std::filesystem::temp_directory_path() / "ecs_tag_snapshot.bin";
+		snapshot.save(world, path.string());
+
+		World restored;
+		snapshot.load(restored, path.string());
+		std::filesystem::remove(path);
+
+		CHECK(restored.has<Frozen>(entities[0]));
+		CHECK(not restored.has<Frozen>(entities[1]));
+	}
+}
+
+TEST_CASE("storage instrumentation", "[ECS]")
+{
+	World world;
+
+	SECTION("a missing storage reports empty stats")
+	{
+		auto stats = world.stats<int>();
+		CHECK(stats.entityCount == 0ull);
+		CHECK(stats.bytesUsed == 0ull);
+	}
+
+	SECTION("structural fields track the storage")
+	{
+		auto entities = world.createEntities(10);
+		world.assign<int>(entities, 1);
+		auto stats = world.stats<int>();
+		CHECK(stats.entityCount == 10ull);
+		CHECK(stats.bytesUsed > 0ull);
+	}
+
+	// The remaining fields need ECS_INSTRUMENTATION, which this test build
+	// defines; shipping builds read them as zero.
+	SECTION("hot-path counters accumulate")
+	{
+		auto entity = world.createEntity();
+		auto before = world.stats<int>();
+		world.onCreate<int>().connect([](World&, Entity) {});
+		world.assign<int>(entity, 1);
+		world.get<int>(entity);
+		world.view<int>().each([](Entity, int) {});
+		world.remove<int>(entity);
+
+		auto stats = world.stats<int>();
+		CHECK(stats.inserts == before.inserts + 1);
+		CHECK(stats.erases == before.erases + 1);
+		CHECK(stats.lookups > before.lookups);
+		CHECK(stats.eventPublishes == before.eventPublishes + 2); // create + remove
+		CHECK(stats.eachCalls == before.eachCalls + 1);
+	}
+}
+
+TEST_CASE("chunked iteration", "[ECS]")
+{
+	World world;
+	auto entities = world.createEntities(100);
+	world.assign<int>(entities, [](Entity entity) { return static_cast<int>(entity.entityId); });
+
+	SECTION("dense views deliver contiguous batches covering every entity")
+	{
+		long sum = 0;
+		std::size_t chunks = 0;
+		world.view<int>().each_chunk(
+			[&](std::span<Entity const> owners, std::span<int const> values)
+			{
+				REQUIRE(owners.size() == values.size());
+				for (auto n: values)
+				{
+					sum += n;
+				}
+				++chunks;
+			},
+			32);
+		CHECK(sum == 4'950);
+		CHECK(chunks == 4ull); // 32 + 32 + 32 + 4
+	}
+
+	SECTION("group chunks expose mutable co-sorted slices")
+	{
+		world.assign<float>(entities, 1.f);
+		auto group = world.group<int, float>();
+		group.each_chunk([](std::span<Entity const>, std::span<int> values, std::span<float> scales)
+		{
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				values[i] *= 2;
+				scales[i] += 1.f;
+			}
+		});
+		CHECK(world.get<int>(entities[30]) == 60);
+		CHECK(world.get<float>(entities[30]) == 2.f);
+	}
+}
+
+TEST_CASE("static world", "[ECS]")
+{
+	StaticWorld<int, float> world;
+
+	SECTION("the core surface matches World")
+	{
+		auto entity = world.createEntity();
+		world.assign<int>(entity, 3);
+		CHECK(world.size() == 1ull);
+		CHECK(world.has<int>(entity));
+		CHECK(world.get<int>(entity) == 3);
+		CHECK(world.try_get<float>(entity) == nullptr);
+
+		world.remove<int>(entity);
+		CHECK(not world.has<int>(entity));
+	}
+
+	SECTION("destroyEntity clears every storage and recycles the id")
+	{
+		auto entity = world.createEntity();
+		world.assign<int>(entity, 1);
+		world.assign<float>(entity, 1.f);
+		world.destroyEntity(entity);
+		CHECK(not world.isAlive(entity));
+
+		auto recycled = world.createEntity();
+		CHECK(recycled.entityId == entity.entityId);
+		CHECK(recycled.generation == entity.generation + 1);
+		CHECK(not world.has<int>(recycled));
+	}
+
+	SECTION("mutation through a stale handle is ignored, like World's")
+	{
+		auto entity = world.createEntity();
+		world.destroyEntity(entity);
+		auto recycled = world.createEntity();
+		world.assign<int>(recycled, 1);
+
+		world.assign<int>(entity, 9);
+		world.remove<int>(entity);
+
+		CHECK(world.get<int>(recycled) == 1);
+		CHECK(world.has<int>(recycled));
+	}
+
+	SECTION("views join storages like World's")
+	{
+		for (int n = 0; n < 10; ++n)
+		{
+			auto entity = world.createEntity();
+			world.assign<int>(entity, n);
+			if (n % 2 == 0)
+			{
+				world.assign<float>(entity, 0.5f);
+			}
+		}
+		int matched = 0;
+		world.view<int, float>().each([&matched](Entity, int, float) { ++matched; });
+		CHECK(matched == 5);
+	}
+}
+
+TEST_CASE("compile-time bound observers", "[ECS]")
+{
+	World world;
+	ObserverSystem system;
+
+	SECTION("member functions connect without a lambda trampoline")
+	{
+		world.onCreate<int>().connect<&ObserverSystem::onCreated>(&system);
+		world.onRemove<int>().connect<&ObserverSystem::onRemoved>(&system);
+
+		auto entity = world.createEntity();
+		world.assign<int>(entity, 1);
+		world.remove<int>(entity);
+
+		CHECK(system.created == 1);
+		CHECK(system.removed == 1);
+	}
+
+	SECTION("free functions connect without an instance")
+	{
+		freeObserverCalls = 0;
+		world.onCreate<int>().connect<&freeObserver>();
+
+		world.assign<int>(world.createEntity(), 1);
+		world.assign<int>(world.createEntity(), 2);
+
+		CHECK(freeObserverCalls == 2);
+	}
+
+	SECTION("bound connections disconnect by id like any other")
+	{
+		auto id = world.onCreate<int>().connect<&ObserverSystem::onCreated>(&system);
+		world.onCreate<int>().disconnect(id);
+
+		world.assign<int>(world.createEntity(), 1);
+
+		CHECK(system.created == 0);
+	}
+}
+
+TEST_CASE("raw component spans", "[ECS]")
+{
+	World world;
+	auto entities = world.createEntities(100);
+	world.assign<int>(entities, [](Entity entity) { return static_cast<int>(entity.entityId); });
+
+	SECTION("the spans alias the packed arrays, index for index")
+	{
+		auto components = world.raw<int>();
+		auto owners = world.rawEntities<int>();
+		REQUIRE(components.size() == 100ull);
+		REQUIRE(owners.size() == 100ull);
+		for (std::size_t i = 0; i < components.size(); ++i)
+		{
+			CHECK(world.get<int>(owners[i]) == components[i]);
+		}
+	}
+
+	SECTION("bulk writes through the span are visible to accessors")
+	{
+		for (auto& n: world.raw<int>())
+		{
+			n *= 2;
+		}
+		CHECK(world.get<int>(entities[21]) == 42);
+	}
+
+	SECTION("missing storages yield empty spans")
+	{
+		CHECK(world.raw<float>().empty());
+		CHECK(world.rawEntities<float>().empty());
+	}
+
+	SECTION("over-aligned components keep their alignment in the array")
+	{
+		world.assign<WideLane>(entities[0], WideLane{});
+		auto lanes = world.raw<WideLane>();
+		CHECK(reinterpret_cast<std::uintptr_t>(lanes.data()) % 32 == 0);
+	}
+}
+
+TEST_CASE("concurrent read access", "[ECS]")
+{
+	World world;
+	auto entities = world.createEntities(1'000);
+	world.assign<int>(entities, [](Entity entity) { return static_cast<int>(entity.entityId); });
+
+	WorldView reader{world};
+
+	SECTION("a WorldView reads through the same API")
+	{
+		CHECK(reader.size() == 1'000ull);
+		CHECK(reader.isAlive(entities[7]));
+		CHECK(reader.get<int>(entities[7]) == 7);
+		CHECK(reader.try_get<float>(entities[7]) == std::nullopt);
+		CHECK(reader.has<int>(entities[7]));
+
+		auto access = reader.readAccess<int>();
+		long sum = 0;
+		reader.view<int>().each([&sum](Entity, int n) { sum += n; });
+		CHECK(sum == 499'500);
+	}
+
+	SECTION("readers on worker threads run against a locking writer")
+	{
+		std::atomic<long> total{0};
+		std::vector<std::thread> workers;
+		for (int worker = 0; worker < 4; ++worker)
+		{
+			workers.emplace_back([&reader, &entities, &total]
+			{
+				long sum = 0;
+				for (int round = 0; round < 100; ++round)
+				{
+					for (auto entity: entities)
+					{
+						sum += reader.get<int>(entity) % 2;
+					}
+				}
+				total += sum;
+			});
+		}
+		for (int round = 0; round < 100; ++round)
+		{
+			auto access = world.writeAccess<int>();
+			for (auto entity: entities)
+			{
+				world.assign<int>(entity, static_cast<int>(entity.entityId) + 2 * round);
+			}
+		}
+		for (auto& worker: workers)
+		{
+			worker.join();
+		}
+		// Every write preserves parity, so readers always see 500 odd values.
+		CHECK(total == 4 * 100 * 500);
+	}
+}
+
+TEST_CASE("copy-on-write cloning", "[ECS]")
+{
+	World world;
+	auto entity = world.createEntity();
+	world.assign<int>(entity, 1);
+	world.assign<float>(entity, 1.f);
+
+	auto snapshot = world.clone();
+
+	SECTION("the clone sees the state at the time of cloning")
+	{
+		CHECK(snapshot.size() == 1ull);
+		CHECK(snapshot.get<int>(entity) == 1);
+	}
+
+	SECTION("mutating the original does not touch the clone")
+	{
+		world.assign<int>(entity, 2);
+		world.destroyEntity(entity);
+		CHECK(snapshot.isAlive(entity));
+		CHECK(snapshot.get<int>(entity) == 1);
+		CHECK(snapshot.get<float>(entity) == 1.f);
+	}
+
+	SECTION("mutating the clone does not touch the original")
+	{
+		snapshot.assign<int>(entity, 3);
+		snapshot.remove<float>(entity);
+		CHECK(world.get<int>(entity) == 1);
+		CHECK(world.has<float>(entity));
+	}
+
+	SECTION("a rollback is just adopting the clone")
+	{
+		world.assign<int>(entity, 2);
+		world = snapshot.clone();
+		CHECK(world.get<int>(entity) == 1);
+	}
+}
+
+TEST_CASE("change tracking", "[ECS]")
+{
+	World world;
+	auto steady = world.createEntity();
+	auto moving = world.createEntity();
+	world.assign<int>(steady, 0);
+	world.assign<int>(moving, 1);
+
+	auto baseline = world.version<int>();
+	world.patch<int>(moving, [](int& n) { n = 2; });
+
+	SECTION("modified() sees only entities changed after the baseline")
+	{
+		int visits = 0;
+		world.modified<int>(baseline).each(
+			[&](Entity e, int n)
+			{
+				++visits;
+				CHECK(e == moving);
+				CHECK(n == 2);
+			}
+		);
+		CHECK(visits == 1);
+	}
+
+	SECTION("a fresh baseline sees nothing")
+	{
+		world.modified<int>(world.version<int>()).each(
+			[](Entity, int) { CHECK(false); }
+		);
+	}
+
+	SECTION("bulk updates stamp every element once")
+	{
+		world.patchAll<int>([](int& n) { ++n; });
+		int visits = 0;
+		world.modified<int>(baseline).each([&visits](Entity, int) { ++visits; });
+		CHECK(visits == 2);
+	}
+}
+
+TEST_CASE("storage sorting", "[ECS]")
+{
+	World world;
+	auto batch = world.createEntities(10);
+	world.assign<int>(batch, [](Entity e) { return 9 - static_cast<int>(e.entityId); });
+
+	world.sort<int>([](int a, int b) { return a < b; });
+
+	SECTION("traversal follows the sorted order")
+	{
+		int previous = -1;
+		for (auto&& [e, n]: world.view<int>())
+		{
+			CHECK(previous < n);
+			previous = n;
+		}
+		CHECK(previous == 9);
+	}
+
+	SECTION("the sparse index stays consistent")
+	{
+		for (auto entity: batch)
+		{
+			CHECK(world.get<int>(entity) == 9 - static_cast<int>(entity.entityId));
+		}
+	}
+}
+
+TEST_CASE("views as standard ranges", "[ECS]")
+{
+	using DenseView = decltype(std::declval<World const&>().view<int>());
+	using JointView = decltype(std::declval<World const&>().view<int, float>());
+	static_assert(std::ranges::random_access_range<DenseView>);
+	static_assert(std::ranges::sized_range<DenseView>);
+	static_assert(std::ranges::view<DenseView>);
+	static_assert(std::ranges::forward_range<JointView>);
+	static_assert(std::ranges::view<JointView>);
+
+	World world;
+	for (int i = 0; i < 10; ++i)
+	{
+		auto entity = world.createEntity();
+		world.assign<int>(entity, i);
+		if (i % 2 == 0)
+		{
+			world.assign<float>(entity, 1.f);
+		}
+	}
+
+	SECTION("dense views are sized and partitionable")
+	{
+		auto view = world.view<int>();
+		CHECK(view.size() == 10ull);
+		auto middle = view.begin() + 5;
+		CHECK(middle - view.begin() == 5);
+		CHECK(std::get<1>(view.begin()[3]) == 3);
+	}
+
+	SECTION("standard algorithms work on views")
+	{
+		auto view = world.view<int>();
+		auto sum = 0;
+		std::ranges::for_each(view, [&sum](auto&& item) { sum += std::get<1>(item); });
+		CHECK(sum == 45);
+		CHECK(std::ranges::distance(world.view<int, float>()) == 5);
+	}
+
+	SECTION("range adaptors work on views")
+	{
+		int visited = 0;
+		for (auto&& [e, n]: world.view<int>() | std::views::take(3))
+		{
+			visited += n >= 0 ? 1 : 0;
+			CHECK(world.isAlive(e));
+		}
+		CHECK(visited == 3);
+	}
+}
+
+TEST_CASE("single-lookup access", "[ECS]")
+{
+	World world;
+	auto entity = world.createEntity();
+	world.assign<int>(entity, 42);
+
+	SECTION("try_get finds present components")
+	{
+		auto* component = world.try_get<int>(entity);
+		REQUIRE(component != nullptr);
+		CHECK(*component == 42);
+	}
+
+	SECTION("try_get returns null on the miss path")
+	{
+		CHECK(world.try_get<float>(entity) == nullptr);
+		world.destroyEntity(entity);
+		CHECK(world.try_get<int>(entity) == nullptr);
+	}
+
+	SECTION("getMany resolves several components at once")
+	{
+		world.assign<float>(entity, 1.f);
+		auto [n, f, c] = world.getMany<int, float, char>(entity);
+		REQUIRE(n != nullptr);
+		REQUIRE(f != nullptr);
+		CHECK(*n == 42);
+		CHECK(*f == 1.f);
+		CHECK(c == nullptr);
+	}
+}
+
+TEST_CASE("batch transforms", "[ECS]")
+{
+	World world;
+	auto batch = world.createEntities(10);
+	world.assign<int>(batch, [](Entity e) { return static_cast<int>(e.entityId); });
+
+	SECTION("patchAll touches every component in one pass")
+	{
+		world.patchAll<int>([](int& n) { n *= 2; });
+		for (auto entity: batch)
+		{
+			CHECK(world.get<int>(entity) == static_cast<int>(entity.entityId) * 2);
+		}
+	}
+
+	SECTION("transformAll replaces every component")
+	{
+		world.transformAll<int>([](int n) { return n + 1; });
+		CHECK(world.get<int>(batch[3]) == static_cast<int>(batch[3].entityId) + 1);
+	}
+
+	SECTION("a single bulk update event is published")
+	{
+		int updates = 0;
+		int bulkUpdates = 0;
+		world.onUpdate<int>().connect([&updates](auto&, auto){ ++updates; });
+		world.onBulkUpdate<int>().connect([&bulkUpdates](auto&){ ++bulkUpdates; });
+		world.patchAll<int>([](int& n) { n = 0; });
+		CHECK(updates == 0);
+		CHECK(bulkUpdates == 1);
+	}
+
+	SECTION("patchAll on a missing storage is a no-op")
+	{
+		CHECK_NOTHROW(world.patchAll<float>([](float&) {}));
+	}
+}
+
 TEST_CASE("World :: callbacks", "[ECS]")
 {
 	World world;
@@ -249,4 +1310,26 @@ TEST_CASE("World :: callbacks", "[ECS]")
 			CHECK_FALSE(called);
 		}
 	}
+	SECTION("Deferred events")
+	{
+		int calls = 0;
+		world.onCreate<int>().connect([&calls](auto&, auto){ ++calls; });
+		world.onCreate<int>().setDeferred(true);
+
+		world.assign<int>(entity, 0);
+		auto another = world.createEntity();
+		world.assign<int>(another, 1);
+		SECTION("are held back until flushed")
+		{
+			CHECK(calls == 0);
+			world.flushEvents();
+			CHECK(calls == 2);
+		}
+		SECTION("flushing twice does not replay them")
+		{
+			world.flushEvents();
+			world.flushEvents();
+			CHECK(calls == 2);
+		}
+	}
 }